@@ -948,6 +948,29 @@
    */
   #define ADAPTIVE_STEP_SMOOTHING
 
+  /**
+   * Input Shaping (EXPERIMENTAL)
+   *
+   * Cancel the ringing of the X and Y axes at their resonant frequency by sending
+   * each step as two or three impulses spread over about one ringing period.
+   * Print the pattern from buildroot/share/scripts/ringing_test.py to find the
+   * frequency, then tune with M593. A frequency of 0 disables shaping of an axis.
+   *
+   * Shapers: SHAPER_ZV, SHAPER_ZVD, SHAPER_MZV, SHAPER_EI
+   * ZV is the quickest. The others take longer and stand more error in the frequency.
+   */
+  //#define INPUT_SHAPING
+  #if ENABLED(INPUT_SHAPING)
+    #define SHAPING_FREQ_X      40.0    // (Hz) Ringing frequency of X
+    #define SHAPING_FREQ_Y      40.0    // (Hz) Ringing frequency of Y
+    #define SHAPING_ZETA_X      0.1     // Damping ratio of X (0.0-0.99)
+    #define SHAPING_ZETA_Y      0.1     // Damping ratio of Y (0.0-0.99)
+    #define SHAPING_TYPE_X SHAPER_MZV
+    #define SHAPING_TYPE_Y SHAPER_MZV
+    #define SHAPING_BUFFER_SIZE 1024    // Steps held per axis for the later impulses. Power of 2.
+                                        // Stepping slows to fit if the steps over one period don't fit.
+  #endif
+
   /**
    * Custom Microstepping
    * Override as-needed for your setup. Up to 3 MS pins are supported.
@@ -1123,6 +1146,15 @@
 
     #define SD_PROCEDURE_DEPTH 1              // Increase if you need more nested M32 calls
 
+    // Stream printed files through a read-ahead buffer of this many 512-byte blocks (2-32),
+    // filled with multi-block reads, instead of reading a byte at a time from the block cache.
+    //#define SD_READ_AHEAD_BLOCKS 4
+
+    // Print heatshrink-compressed .gcz files (window 8, lookahead 4), decoding as they're read.
+    // Compress with buildroot/share/scripts/gcode_compress.py. Uses about 350 bytes of RAM.
+    // Seeking (M26, M24 S, power-loss resume) decodes from the top of the file up to the position.
+    //#define SD_COMPRESSED_GCODE
+
     #define SD_FINISHED_STEPPERRELEASE true   // Disable steppers when SD Print is finished
     #define SD_FINISHED_RELEASECOMMAND "M84"  // Use "M84XYE" to keep Z enabled so your bed stays in place
 
@@ -1162,6 +1194,13 @@
       // Without a POWER_LOSS_PIN the following option helps reduce wear on the SD card,
       // especially with "vase mode" printing. Set too high and vases cannot be continued.
       #define POWER_LOSS_MIN_Z_CHANGE 0.05 // (mm) Minimum Z change before saving power-loss data
+
+      // Write power-loss data from idle() instead of during G-code handling. Between full
+      // saves append small records with the position, temperatures, etc. to a journal.
+      //#define POWER_LOSS_JOURNAL
+      #if ENABLED(POWER_LOSS_JOURNAL)
+        #define POWER_LOSS_JOURNAL_RECORDS 32 // Records between full saves
+      #endif
     #endif
 
     /**
@@ -1202,6 +1241,20 @@
                                         // Note: Only affects SCROLL_LONG_FILENAMES with SDSORT_CACHE_NAMES but not SDSORT_DYNAMIC_RAM.
     #endif
 
+    /**
+     * Index the working directory in RAM the first time it's listed after a mount or
+     * folder change. Each item keeps its 8.3 name, the start of its long name, its size
+     * and first cluster, and where its directory entries are, so menus read one entry
+     * per item shown instead of scanning the folder. With SDCARD_SORT_ALPHA the index is
+     * heapsorted, replacing SDSORT_LIMIT and the SDSORT_USES_RAM methods.
+     * Costs 24 bytes per item plus the key, and 2 more for sorting.
+     */
+    //#define SDCARD_DIR_INDEX
+    #if ENABLED(SDCARD_DIR_INDEX)
+      #define SDCARD_DIR_INDEX_LIMIT 128  // Maximum number of indexed items. More are listed (unsorted) by scanning.
+      #define SDCARD_DIR_INDEX_KEY    12  // Characters of the long name kept for sorting. Ties read the full names.
+    #endif
+
     // This allows hosts to request long names for files and folders with M33
     //#define LONG_FILENAME_HOST_SUPPORT
 
@@ -1230,6 +1283,15 @@
      */
     //#define AUTO_REPORT_SD_STATUS
 
+    /**
+     * Estimate the time left in SD prints from the planned move times.
+     * The time of each move, as planned with acceleration, is matched to
+     * its place in the file. A time left sent with M73 R (by the host or
+     * the slicer) is blended in while most of the file is still to go.
+     * Reported by M27 and M73, on the status screen, and to ExtUI.
+     */
+    //#define PRINT_TIME_ESTIMATE
+
     /**
      * Support for USB thumb drives using an Arduino USB Host Shield or
      * equivalent MAX3421E breakout board. The USB thumb drive will appear
@@ -1659,6 +1721,39 @@
     //#define MESH_MAX_Y Y_BED_SIZE - (MESH_INSET)
   #endif
 
+  /**
+   * Keep a table of bilinear coefficients for each mesh cell, rebuilt
+   * when the mesh changes, so a Z correction costs a cell lookup and
+   * three multiply-adds. Segmented UBL moves are corrected in batches.
+   * Uses 16 bytes of RAM per mesh cell (or subdivided cell).
+   */
+  #if EITHER(AUTO_BED_LEVELING_BILINEAR, AUTO_BED_LEVELING_UBL)
+    //#define MESH_CELL_CACHE
+    #if ENABLED(MESH_CELL_CACHE)
+      /**
+       * Fit a smooth bicubic patch to each cell, using the mesh points
+       * around it, so a coarser mesh (and a quicker G29) does the job.
+       * Uses 64 bytes per cell. 'M420 B0' switches back to bilinear.
+       * Long moves are only leveled at cell borders on a Cartesian without
+       * SEGMENT_LEVELED_MOVES or UBL_SEGMENTED, missing the curve between.
+       */
+      //#define MESH_BICUBIC
+    #endif
+  #endif
+
+  /**
+   * Plan the order of G29 probe points before probing, to cut travel.
+   * Start with the nearest point each time and improve the route with
+   * 2-opt passes, each taking time in proportion to points². Report the
+   * route with an estimated probing time. (G29 V1 and up for ABL.)
+   */
+  #if HAS_BED_PROBE && ANY(AUTO_BED_LEVELING_LINEAR, AUTO_BED_LEVELING_BILINEAR, AUTO_BED_LEVELING_UBL)
+    //#define PROBE_ROUTE
+    #if ENABLED(PROBE_ROUTE)
+      #define PROBE_ROUTE_PASSES 4  // Use fewer for a slow MCU and a large mesh
+    #endif
+  #endif
+
   /**
    * Repeatedly attempt G29 leveling until it succeeds.
    * Stop after G29_MAX_RETRIES attempts.
@@ -1749,14 +1844,30 @@
     //#define ARC_SEGMENTS_PER_R    1 // Max segment length, MM_PER = Min
     #define MIN_ARC_SEGMENTS       24 // Minimum number of segments in a complete circle
     //#define ARC_SEGMENTS_PER_SEC 50 // Use feedrate to choose segment length (with MM_PER_ARC_SEGMENT as the minimum)
+    //#define ARC_CHORD_TOLERANCE 0.01 // (mm) Use the radius to choose segment length for this max deviation (with MM_PER_ARC_SEGMENT as the minimum)
     #define N_ARC_CORRECTION       25 // Number of interpolated segments between corrections
     //#define ARC_P_CIRCLES           // Enable the 'P' parameter to specify complete circles
     //#define CNC_WORKSPACE_PLANES    // Allow G2/G3 to operate in XY, ZX, or YZ planes
+    //#define ARC_BLOCKS              // EXPERIMENTAL: Step XY arcs directly as single planner blocks. 32-bit only.
+                                      // Cartesian only. Falls back to segments with leveling or unequal X/Y steps/mm.
   #endif
 
   // Support for G5 with XYZE destination and IJPQ offsets. Requires ~2666 bytes.
   //#define BEZIER_CURVE_SUPPORT
 
+  /**
+   * Kinematic Segment Tolerance
+   *
+   * Split DELTA and SCARA moves by how far the carriages or arms would stray
+   * from the true path between segments, instead of by time. Fewer segments
+   * are made where the kinematics are near-linear (e.g., near the center)
+   * and more near the edge of the workspace.
+   * DELTA_SEGMENTS_PER_SECOND / SCARA_SEGMENTS_PER_SECOND are then unused.
+   */
+  #if IS_KINEMATIC
+    //#define KINEMATIC_SEGMENT_TOLERANCE 10 // (µm) Max deviation between segments
+  #endif
+
   /**
    * Direct Stepping
    *
@@ -1906,6 +2017,11 @@
   // Some clients will have this feature soon. This could make the NO_TIMEOUTS unnecessary.
   //#define ADVANCED_OK
 
+  // Let hosts stream numbered lines ahead of the "ok". After 'M576 S<lines>' the host may
+  // send up to that many lines before waiting, and one "ok N<line> P<planner> B<buffer>"
+  // acknowledges every line up to N. 'M576 S0' goes back to one "ok" per line.
+  //#define SERIAL_WINDOW_ACK
+
   // Printrun may have trouble receiving long strings all at once.
   // This option inserts short delays between lines of serial output.
   #define SERIAL_OVERRUN_PROTECTION
@@ -3131,6 +3247,10 @@
 
   #if ENABLED(FASTER_GCODE_PARSER)
     //#define GCODE_QUOTED_STRINGS  // Support for quoted string parameters
+    //#define GCODE_VALUE_CACHE     // Spend 105 bytes of SRAM to convert parameter values once, while parsing
+    #if ENABLED(GCODE_VALUE_CACHE)
+      //#define BINARY_GCODE        // Run pre-tokenized binary commands from SD files and 'M28 B1' binary transfer packets
+    #endif
   #endif
 
   //#define GCODE_CASE_INSENSITIVE  // Accept G-code sent to the firmware in lowercase
@@ -3222,6 +3342,18 @@
    * Implement M486 to allow Marlin to skip objects
    */
   //#define CANCEL_OBJECTS
+  #if ENABLED(CANCEL_OBJECTS)
+    /**
+     * Scan SD prints ahead of the reader for the lines of each M486 object, and
+     * seek past canceled objects instead of reading them line by line. Objects
+     * with commands other than G0-G3, G92 E, M73 and M117 are still read.
+     * Uses 20 bytes per range plus a 600 byte scan buffer.
+     */
+    //#define CANCEL_OBJECTS_INDEX
+    #if ENABLED(CANCEL_OBJECTS_INDEX)
+      #define CANCEL_OBJECTS_INDEX_SIZE 32  // Object ranges to hold ahead of the reader
+    #endif
+  #endif
 
   /**
    * I2C position encoders for closed loop control.
@@ -3509,5 +3641,17 @@
   //
  // #define PINS_DEBUGGING
 
+  //
+  // M123 - Profile the Stepper ISR. Reports per-phase timing, histograms of the
+  // ISR duration and of missed deadlines, and how often the catch-up loop gave up.
+  //
+  //#define STEPPER_ISR_PROFILER
+
+  //
+  // M124 - Benchmark the planner. Plans a circle of short segments into a
+  // full buffer, with the Stepper ISR paused, and reports blocks per second.
+  //
+  //#define PLANNER_BENCHMARK
+
   // Enable Marlin dev mode which adds some special commands
   //#define MARLIN_DEV_MODE
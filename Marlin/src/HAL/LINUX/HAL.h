@@ -79,6 +79,18 @@ extern HalSerial usb_serial;
 
 inline void HAL_init() {}
 
+#ifdef LINUX_VIRTUAL_TIME
+  // Serial I/O and idle time are serviced by the virtual time scheduler
+  #define HAL_IDLETASK 1
+  void HAL_idletask();
+#endif
+
+#if ENABLED(INPUT_SHAPING)
+  // The simulator can log the X/Y steps as planned, before input shaping
+  #define HAL_SHAPING_TRACE 1
+  void HAL_shaping_trace(const uint8_t axis, const bool reverse);
+#endif
+
 // Utility functions
 #pragma GCC diagnostic push
 #pragma GCC diagnostic ignored "-Wunused-function"
@@ -35,47 +35,64 @@
 uint8_t buffer[MARLIN_EEPROM_SIZE];
 char filename[] = "eeprom.dat";
 
+// The span of bytes changed since access_start. Only these are written back.
+static int dirty_start, dirty_end;
+
 size_t PersistentStore::capacity() { return MARLIN_EEPROM_SIZE; }
 
 bool PersistentStore::access_start() {
   const char eeprom_erase_value = 0xFF;
-  FILE * eeprom_file = fopen(filename, "rb");
-  if (eeprom_file == nullptr) return false;
+  dirty_start = MARLIN_EEPROM_SIZE;
+  dirty_end = 0;
 
-  fseek(eeprom_file, 0L, SEEK_END);
-  std::size_t file_size = ftell(eeprom_file);
+  // A missing file is a blank EEPROM
+  std::size_t file_size = 0;
+  FILE * eeprom_file = fopen(filename, "rb");
+  if (eeprom_file) {
+    file_size = fread(buffer, sizeof(uint8_t), sizeof(buffer), eeprom_file);
+    fclose(eeprom_file);
+  }
 
   if (file_size < MARLIN_EEPROM_SIZE) {
     memset(buffer + file_size, eeprom_erase_value, MARLIN_EEPROM_SIZE - file_size);
-  }
-  else {
-    fseek(eeprom_file, 0L, SEEK_SET);
-    fread(buffer, sizeof(uint8_t), sizeof(buffer), eeprom_file);
+    // Write the whole file on the next access_finish
+    if (file_size) dirty_start = 0, dirty_end = MARLIN_EEPROM_SIZE;
   }
 
-  fclose(eeprom_file);
   return true;
 }
 
 bool PersistentStore::access_finish() {
-  FILE * eeprom_file = fopen(filename, "wb");
-  if (eeprom_file == nullptr) return false;
-  fwrite(buffer, sizeof(uint8_t), sizeof(buffer), eeprom_file);
+  if (dirty_start >= dirty_end) return true; // Nothing changed
+
+  // Rewrite only the bytes that changed
+  FILE * eeprom_file = fopen(filename, "r+b");
+  if (eeprom_file == nullptr) {
+    eeprom_file = fopen(filename, "wb");
+    if (eeprom_file == nullptr) return false;
+    dirty_start = 0;
+    dirty_end = MARLIN_EEPROM_SIZE;
+  }
+  const std::size_t len = dirty_end - dirty_start;
+  const bool ok = fseek(eeprom_file, dirty_start, SEEK_SET) == 0
+               && fwrite(buffer + dirty_start, sizeof(uint8_t), len, eeprom_file) == len;
   fclose(eeprom_file);
-  return true;
+  if (ok) { dirty_start = MARLIN_EEPROM_SIZE; dirty_end = 0; }
+  return ok;
 }
 
 bool PersistentStore::write_data(int &pos, const uint8_t *value, size_t size, uint16_t *crc) {
-  std::size_t bytes_written = 0;
-
   for (std::size_t i = 0; i < size; i++) {
-    buffer[pos+i] = value[i];
-    bytes_written ++;
+    if (buffer[pos + i] != value[i]) {
+      buffer[pos + i] = value[i];
+      NOMORE(dirty_start, pos + int(i));
+      NOLESS(dirty_end, pos + int(i) + 1);
+    }
   }
 
   crc16(crc, value, size);
   pos = pos + size;
-  return (bytes_written != size);  // return true for any error
+  return false;
 }
 
 bool PersistentStore::read_data(int &pos, uint8_t* value, const size_t size, uint16_t *crc, const bool writing/*=true*/) {
@@ -24,10 +24,18 @@
 #include <chrono>
 #include <thread>
 
+#ifdef LINUX_VIRTUAL_TIME
+  #include "Scheduler.h"
+#endif
+
 class Clock {
 public:
   static uint64_t ticks(uint32_t frequency = Clock::frequency) {
-    return (Clock::nanos() - Clock::startup.count()) / (1000000000ULL / frequency);
+    #ifdef LINUX_VIRTUAL_TIME
+      return Clock::nanos() / (1000000000ULL / frequency);
+    #else
+      return (Clock::nanos() - Clock::startup.count()) / (1000000000ULL / frequency);
+    #endif
   }
 
   static uint64_t nanosToTicks(uint64_t ns, uint32_t frequency = Clock::frequency) {
@@ -36,7 +44,11 @@ public:
 
   // Time acceleration compensated
   static uint64_t ticksToNanos(uint64_t tick, uint32_t frequency = Clock::frequency) {
-    return (tick * (1000000000ULL / frequency)) / Clock::time_multiplier;
+    #ifdef LINUX_VIRTUAL_TIME
+      return tick * (1000000000ULL / frequency);
+    #else
+      return (tick * (1000000000ULL / frequency)) / Clock::time_multiplier;
+    #endif
   }
 
   static void setFrequency(uint32_t freq) {
@@ -45,8 +57,12 @@ public:
 
   // Time Acceleration compensated
   static uint64_t nanos() {
-    auto now = std::chrono::high_resolution_clock::now().time_since_epoch();
-    return (now.count() - Clock::startup.count()) * Clock::time_multiplier;
+    #ifdef LINUX_VIRTUAL_TIME
+      return Scheduler::nanos();
+    #else
+      auto now = std::chrono::high_resolution_clock::now().time_since_epoch();
+      return (now.count() - Clock::startup.count()) * Clock::time_multiplier;
+    #endif
   }
 
   static uint64_t micros() {
@@ -62,19 +78,35 @@ public:
   }
 
   static void delayCycles(uint64_t cycles) {
-    std::this_thread::sleep_for(std::chrono::nanoseconds( (1000000000L / frequency) * cycles) / Clock::time_multiplier );
+    #ifdef LINUX_VIRTUAL_TIME
+      Scheduler::delay((1000000000L / frequency) * cycles);
+    #else
+      std::this_thread::sleep_for(std::chrono::nanoseconds( (1000000000L / frequency) * cycles) / Clock::time_multiplier );
+    #endif
   }
 
   static void delayMicros(uint64_t micros) {
-    std::this_thread::sleep_for(std::chrono::microseconds( micros ) / Clock::time_multiplier);
+    #ifdef LINUX_VIRTUAL_TIME
+      Scheduler::delay(micros * 1000ULL);
+    #else
+      std::this_thread::sleep_for(std::chrono::microseconds( micros ) / Clock::time_multiplier);
+    #endif
   }
 
   static void delayMillis(uint64_t millis) {
-    std::this_thread::sleep_for(std::chrono::milliseconds( millis ) / Clock::time_multiplier);
+    #ifdef LINUX_VIRTUAL_TIME
+      Scheduler::delay(millis * 1000000ULL);
+    #else
+      std::this_thread::sleep_for(std::chrono::milliseconds( millis ) / Clock::time_multiplier);
+    #endif
   }
 
   static void delaySeconds(double secs) {
-    std::this_thread::sleep_for(std::chrono::duration<double, std::milli>(secs * 1000) / Clock::time_multiplier);
+    #ifdef LINUX_VIRTUAL_TIME
+      Scheduler::delay(uint64_t(secs * 1000000000.0));
+    #else
+      std::this_thread::sleep_for(std::chrono::duration<double, std::milli>(secs * 1000) / Clock::time_multiplier);
+    #endif
   }
 
   // Will reduce timer resolution increasing likelihood of overflows
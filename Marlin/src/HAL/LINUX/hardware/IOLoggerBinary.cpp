@@ -0,0 +1,89 @@
+/**
+ * Marlin 3D Printer Firmware
+ * Copyright (c) 2020 MarlinFirmware [https://github.com/MarlinFirmware/Marlin]
+ *
+ * Based on Sprinter and grbl.
+ * Copyright (c) 2011 Camiel Gubbels / Erik van der Zalm
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+#ifdef __PLAT_LINUX__
+
+#include <string.h>
+#include "IOLoggerBinary.h"
+
+IOLoggerBinary::IOLoggerBinary(const char *filename, const std::vector<TraceAxis> &axes) : last(0), started(false), count(0) {
+  file = fopen(filename, "wb");
+  if (!file) { perror(filename); return; }
+
+  // The start time goes in when the first event comes
+  const char magic[8] = "MGPIOTR";
+  const uint32_t version = 1, record_size = sizeof(Record), axis_count = axes.size();
+  const uint64_t start = 0;
+  fwrite(magic, sizeof(magic), 1, file);
+  fwrite(&version, sizeof(version), 1, file);
+  fwrite(&record_size, sizeof(record_size), 1, file);
+  fwrite(&start, sizeof(start), 1, file);
+  fwrite(&axis_count, sizeof(axis_count), 1, file);
+  for (const TraceAxis &a : axes) {
+    const uint8_t flags = (a.invert_dir ? 1 : 0) | (a.enable_on ? 2 : 0);
+    const int16_t pins[3] = { a.step_pin, a.dir_pin, a.enable_pin };
+    fwrite(&a.name, 1, 1, file);
+    fwrite(&flags, 1, 1, file);
+    fwrite(pins, sizeof(pins), 1, file);
+    fwrite(&a.steps_per_mm, sizeof(a.steps_per_mm), 1, file);
+  }
+}
+
+IOLoggerBinary::~IOLoggerBinary() {
+  if (!file) return;
+  flush();
+  fclose(file);
+}
+
+void IOLoggerBinary::add(const Record &r) {
+  buffer[count++] = r;
+  if (count == COUNT(buffer)) {
+    fwrite(buffer, sizeof(Record), count, file);
+    count = 0;
+  }
+}
+
+void IOLoggerBinary::log(GpioEvent ev) {
+  if (!file || ev.event == GpioEvent::NOP) return;  // Writes that change nothing, like a polled chip select
+  std::lock_guard<std::mutex> lock(buffer_lock);
+  if (!started) {
+    started = true;
+    last = ev.timestamp;
+    fseek(file, 16, SEEK_SET);
+    fwrite(&last, sizeof(last), 1, file);
+    fseek(file, 0, SEEK_END);
+  }
+  // Events from other threads can be a little out of order. Keep deltas positive.
+  uint64_t delta = ev.timestamp > last ? ev.timestamp - last : 0;
+  last += delta;
+  for (; delta > UINT32_MAX; delta -= UINT32_MAX) add({ UINT32_MAX, 0, TIME, 0 });
+  add({ uint32_t(delta), uint8_t(ev.pin_id), uint8_t(ev.event), Gpio::pin_map[ev.pin_id].value });
+}
+
+void IOLoggerBinary::flush() {
+  std::lock_guard<std::mutex> lock(buffer_lock);
+  if (!file || !count) return;
+  fwrite(buffer, sizeof(Record), count, file);
+  count = 0;
+  fflush(file);
+}
+
+#endif // __PLAT_LINUX__
@@ -0,0 +1,84 @@
+/**
+ * Marlin 3D Printer Firmware
+ * Copyright (c) 2020 MarlinFirmware [https://github.com/MarlinFirmware/Marlin]
+ *
+ * Based on Sprinter and grbl.
+ * Copyright (c) 2011 Camiel Gubbels / Erik van der Zalm
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+#pragma once
+
+/**
+ * A compact trace of GPIO events, for whole prints. Pin writes
+ * that don't change anything (GpioEvent::NOP) are left out.
+ * Read it with buildroot/share/scripts/gpio_trace.py.
+ *
+ * Header, little-endian:
+ *   char[8]  "MGPIOTR" and a NUL
+ *   uint32   Format version (1)
+ *   uint32   Record size (8)
+ *   uint64   Time of the first record (ns)
+ *   uint32   Number of axes, then for each axis:
+ *     char     Name
+ *     uint8    Flags: 1 = DIR inverted, 2 = enabled when ENABLE is high
+ *     int16    STEP, DIR and ENABLE pins
+ *     float    Steps per mm
+ *
+ * Records:
+ *   uint32   ns since the previous record
+ *   uint8    Pin
+ *   uint8    GpioEvent::Type, or TIME to carry a gap too long for 32 bits
+ *   uint16   Pin value after the event
+ */
+
+#include <stdio.h>
+#include <mutex>
+#include <vector>
+#include "Gpio.h"
+
+struct TraceAxis {
+  char name;
+  bool invert_dir, enable_on;
+  pin_type step_pin, dir_pin, enable_pin;
+  float steps_per_mm;
+};
+
+class IOLoggerBinary: public IOLogger {
+public:
+  static constexpr uint8_t TIME = 0xFF;
+
+  IOLoggerBinary(const char *filename, const std::vector<TraceAxis> &axes);
+  virtual ~IOLoggerBinary();
+  void flush();
+  void log(GpioEvent ev);
+
+private:
+  struct Record {
+    uint32_t delta;
+    uint8_t pin, event;
+    uint16_t value;
+  };
+  static_assert(sizeof(Record) == 8, "Trace records must be 8 bytes");
+
+  FILE *file;
+  uint64_t last;
+  bool started;
+  Record buffer[8192];  // Written out when full, so nothing is formatted or flushed per event
+  size_t count;
+  std::mutex buffer_lock;
+
+  void add(const Record &r);
+};
@@ -39,7 +39,7 @@ void IOLoggerCSV::log(GpioEvent ev) {
 void IOLoggerCSV::flush() {
   { std::lock_guard<std::mutex> lock(vector_lock);
     while (!events.empty()) {
-      file << events.front().timestamp << ", "<< events.front().pin_id << ", " << events.front().event << std::endl;
+      file << events.front().timestamp << ", "<< events.front().pin_id << ", " << events.front().event << '\n';
       events.pop_front();
     }
   }
@@ -0,0 +1,78 @@
+/**
+ * Marlin 3D Printer Firmware
+ * Copyright (c) 2020 MarlinFirmware [https://github.com/MarlinFirmware/Marlin]
+ *
+ * Based on Sprinter and grbl.
+ * Copyright (c) 2011 Camiel Gubbels / Erik van der Zalm
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+#if defined(__PLAT_LINUX__) && defined(LINUX_VIRTUAL_TIME)
+
+#include "Scheduler.h"
+
+EventSource* Scheduler::sources[Scheduler::max_sources];
+uint8_t Scheduler::source_count = 0;
+uint64_t Scheduler::now_ns = 0;
+uint64_t Scheduler::fired = 0;
+bool Scheduler::in_isr = false;
+
+EventSource* Scheduler::nextSource(uint64_t &due) {
+  EventSource* next = nullptr;
+  due = EventSource::NEVER;
+  for (uint8_t i = 0; i < source_count; i++) {
+    const uint64_t t = sources[i]->nextEvent();
+    if (t < due) { due = t; next = sources[i]; }
+  }
+  return next;
+}
+
+/**
+ * Fire everything due at or before 'until', earliest first.
+ * Interrupts don't nest, so an event raised from inside a
+ * handler waits until that handler returns.
+ */
+bool Scheduler::dispatch(uint64_t until) {
+  if (in_isr) return false;
+  bool any = false;
+  for (;;) {
+    uint64_t due;
+    EventSource * const next = nextSource(due);
+    if (!next || due > until) break;
+    if (due > now_ns) now_ns = due;
+    in_isr = true;
+    next->fire();
+    in_isr = false;
+    fired++;
+    any = true;
+  }
+  return any;
+}
+
+void Scheduler::runUntil(uint64_t until) {
+  dispatch(until);
+  if (until > now_ns) now_ns = until;
+}
+
+void Scheduler::yield() {
+  if (in_isr) { now_ns += read_cost_ns; return; }
+  uint64_t due;
+  if (nextSource(due) && due != EventSource::NEVER)
+    runUntil(due);
+  else
+    now_ns += read_cost_ns;
+}
+
+#endif // __PLAT_LINUX__ && LINUX_VIRTUAL_TIME
@@ -0,0 +1,98 @@
+/**
+ * Marlin 3D Printer Firmware
+ * Copyright (c) 2020 MarlinFirmware [https://github.com/MarlinFirmware/Marlin]
+ *
+ * Based on Sprinter and grbl.
+ * Copyright (c) 2011 Camiel Gubbels / Erik van der Zalm
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+#pragma once
+
+/**
+ * Discrete-event scheduler for the virtual time simulator (LINUX_VIRTUAL_TIME)
+ *
+ * Everything runs on the main thread. Time only moves when the firmware
+ * reads the clock, delays, or idles, and it jumps straight to the next
+ * pending event instead of waiting for it. Timer interrupts are dispatched
+ * in due order (ties go to the first attached source), so a given input
+ * always produces the same output, as fast as the host can run it.
+ */
+
+#include <stdint.h>
+#include <functional>
+
+class EventSource {
+public:
+  static constexpr uint64_t NEVER = UINT64_MAX;
+
+  virtual ~EventSource() {}
+  virtual uint64_t nextEvent() = 0;   // Virtual time (ns) of the next event, or NEVER
+  virtual void fire() = 0;            // Called with the clock set to nextEvent()
+};
+
+// A peripheral update that runs at a fixed virtual period
+class PeriodicTask : public EventSource {
+public:
+  PeriodicTask(uint64_t period_ns, std::function<void()> fn) : period(period_ns), due(period_ns), task(fn) {}
+  uint64_t nextEvent() { return due; }
+  void fire() { due += period; task(); }
+
+private:
+  uint64_t period, due;
+  std::function<void()> task;
+};
+
+class Scheduler {
+public:
+  static constexpr uint8_t max_sources = 8;
+
+  // Each clock read costs a few instructions so polling loops always make progress
+  static constexpr uint64_t read_cost_ns = 100;
+
+  static void attach(EventSource* source) {
+    if (source_count < max_sources) sources[source_count++] = source;
+  }
+
+  // Current virtual time without side effects
+  static uint64_t now() { return now_ns; }
+
+  // Clock read as seen by the firmware
+  static uint64_t nanos() {
+    now_ns += read_cost_ns;
+    if (!in_isr) dispatch(now_ns);
+    return now_ns;
+  }
+
+  // Advance time by a busy-wait delay, servicing interrupts on the way
+  static void delay(uint64_t ns) { runUntil(now_ns + ns); }
+
+  // Skip idle time up to the next pending event and service it
+  static void yield();
+
+  // Service every event due at or before 'until', then set the clock there
+  static void runUntil(uint64_t until);
+
+  static uint64_t eventsFired() { return fired; }
+
+private:
+  static bool dispatch(uint64_t until);
+  static EventSource* nextSource(uint64_t &due);
+
+  static EventSource* sources[max_sources];
+  static uint8_t source_count;
+  static uint64_t now_ns, fired;
+  static bool in_isr;
+};
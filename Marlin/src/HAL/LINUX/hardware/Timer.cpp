@@ -24,6 +24,48 @@
 #include "Timer.h"
 #include <stdio.h>
 
+#ifdef LINUX_VIRTUAL_TIME
+
+Timer::Timer() {
+  active = false;
+  compare = 0;
+  frequency = 0;
+  overruns = 0;
+  cbfn = nullptr;
+  start_time = 0;
+}
+
+Timer::~Timer() {}
+
+void Timer::init(uint32_t sig_id, uint32_t sim_freq, callback_fn* fn) {
+  frequency = sim_freq;
+  cbfn = fn;
+  Scheduler::attach(this);
+}
+
+void Timer::start(uint32_t frequency) {
+  start_time = Scheduler::now();
+  setCompare(this->frequency / frequency);
+}
+
+uint32_t Timer::getCount() {
+  return Clock::nanosToTicks(Clock::nanos() - start_time, frequency);
+}
+
+uint64_t Timer::nextEvent() {
+  if (!active || !cbfn) return NEVER;
+  return start_time + Clock::ticksToNanos(compare ? compare : 1, frequency);
+}
+
+void Timer::fire() {
+  const uint64_t now = Scheduler::now();
+  if (now > nextEvent()) overruns++;  // The compare was set behind the count
+  start_time = now;
+  cbfn();
+}
+
+#else
+
 Timer::Timer() {
   active = false;
   compare = 0;
@@ -114,4 +156,6 @@ uint32_t Timer::getCount() {
   return Clock::nanosToTicks(Clock::nanos() - this->start_time, frequency);
 }
 
+#endif // LINUX_VIRTUAL_TIME
+
 #endif // __PLAT_LINUX__
@@ -30,6 +30,45 @@
 
 #include "Clock.h"
 
+#ifdef LINUX_VIRTUAL_TIME
+
+/**
+ * Match-and-reset timer driven by the virtual time Scheduler.
+ * The count restarts when the compare value is matched, like the
+ * LPC176x MR0 reset, and the ISR runs on the main thread.
+ */
+class Timer : public EventSource {
+public:
+  Timer();
+  virtual ~Timer();
+
+  typedef void (callback_fn)();
+
+  void init(uint32_t sig_id, uint32_t sim_freq, callback_fn* fn);
+  void start(uint32_t frequency);
+  void enable() {active = true;}
+  bool enabled() {return active;}
+  void disable() {active = false;}
+  void setCompare(uint32_t compare) {this->compare = compare;}
+  uint32_t getCount();
+  uint32_t getCompare() {return compare;}
+  uint32_t getOverruns() {return overruns;}
+  uint32_t getAvgError() {return 0;}
+
+  uint64_t nextEvent();
+  void fire();
+
+private:
+  bool active;
+  uint32_t compare;
+  uint32_t frequency;
+  uint32_t overruns;
+  callback_fn* cbfn;
+  uint64_t start_time;
+};
+
+#else
+
 class Timer {
 public:
   Timer();
@@ -74,3 +113,5 @@ private:
   uint64_t avg_error;
   uint64_t start_time;
 };
+
+#endif // LINUX_VIRTUAL_TIME
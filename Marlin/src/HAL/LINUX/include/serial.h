@@ -29,6 +29,43 @@
 #include <stdarg.h>
 #include <stdio.h>
 
+#ifndef LINUX_VIRTUAL_TIME
+  #include <atomic>
+  #include <condition_variable>
+  #include <mutex>
+
+  /**
+   * Let a serial thread sleep until the other side has news for it.
+   * The news itself goes in a RingBuffer, and notify() only takes
+   * the lock if somebody is asleep, so it's cheap to call per byte.
+   */
+  class SerialEvent {
+  public:
+    template<typename F>
+    void wait(F ready) {
+      if (ready()) return;
+      std::unique_lock<std::mutex> lock(mutex);
+      sleeping = true;
+      std::atomic_thread_fence(std::memory_order_seq_cst); // Pairs with notify()
+      while (!ready()) cond.wait(lock);
+      sleeping = false;
+    }
+
+    void notify() {
+      std::atomic_thread_fence(std::memory_order_seq_cst); // Post the news before checking for sleepers
+      if (sleeping) {
+        std::lock_guard<std::mutex> lock(mutex);
+        cond.notify_all();
+      }
+    }
+
+  private:
+    std::mutex mutex;
+    std::condition_variable cond;
+    std::atomic<bool> sleeping { false };
+  };
+#endif
+
 /**
  * Generic RingBuffer
  * T type of the buffer array
@@ -62,6 +99,21 @@ public:
     return true;
   }
 
+  // Copy up to n values out or in. Return the number copied.
+  uint32_t read(T *values, uint32_t n) volatile {
+    NOMORE(n, available());
+    for (uint32_t i = 0; i < n; i++) values[i] = buffer[mask(index_read + i)];
+    index_read += n;
+    return n;
+  }
+
+  uint32_t write(const T *values, uint32_t n) volatile {
+    NOMORE(n, free());
+    for (uint32_t i = 0; i < n; i++) buffer[mask(index_write + i)] = values[i];
+    index_write += n;   // Only now can the reader see them
+    return n;
+  }
+
 private:
   uint32_t mask(uint32_t val) volatile {
     return buffer_mask & val;
@@ -92,12 +144,26 @@ public:
     return receive_buffer.peek(&value) ? value : -1;
   }
 
-  int read() { return receive_buffer.read(); }
+  int read() {
+    const int c = receive_buffer.read();
+    #ifndef LINUX_VIRTUAL_TIME
+      if (c >= 0) rx_space.notify();
+    #endif
+    return c;
+  }
 
   size_t write(char c) {
     if (!host_connected) return 0;
-    while (!transmit_buffer.free());
-    return transmit_buffer.write(c);
+    #ifdef LINUX_VIRTUAL_TIME
+      if (!transmit_buffer.free()) flushTX(); // No writer thread to drain it
+      return transmit_buffer.write(c);
+    #else
+      tx_space.wait([this]{ return !transmit_buffer.full(); });
+      transmit_buffer.write(c);
+      // Wake the writer thread for a whole line, not every character
+      if (c == '\n' || transmit_buffer.available() >= 64) tx_data.notify();
+      return 1;
+    #endif
   }
 
   operator bool() { return host_connected; }
@@ -113,8 +179,15 @@ public:
   }
 
   void flushTX() {
-    if (host_connected)
-      while (transmit_buffer.available()) { /* nada */ }
+    #ifdef LINUX_VIRTUAL_TIME
+      uint8_t chunk[128];
+      while (const uint32_t n = transmit_buffer.read(chunk, sizeof(chunk))) fwrite(chunk, 1, n, stdout);
+    #else
+      if (host_connected) {
+        tx_data.notify();
+        tx_space.wait([this]{ return transmit_buffer.empty(); });
+      }
+    #endif
   }
 
   void printf(const char *format, ...) {
@@ -124,13 +197,8 @@ public:
     int length = vsnprintf((char *) buffer, 256, (char const *) format, vArgs);
     va_end(vArgs);
     if (length > 0 && length < 256) {
-      if (host_connected) {
-        for (int i = 0; i < length;) {
-          if (transmit_buffer.write(buffer[i])) {
-            ++i;
-          }
-        }
-      }
+      if (host_connected)
+        for (int i = 0; i < length; i++) write(buffer[i]);
     }
   }
 
@@ -205,4 +273,10 @@ public:
   volatile RingBuffer<uint8_t, 128> receive_buffer;
   volatile RingBuffer<uint8_t, 128> transmit_buffer;
   volatile bool host_connected;
+
+  #ifndef LINUX_VIRTUAL_TIME
+    SerialEvent rx_space,   // The firmware read from receive_buffer
+                tx_data,    // The firmware wrote to transmit_buffer
+                tx_space;   // The writer thread emptied transmit_buffer
+  #endif
 };
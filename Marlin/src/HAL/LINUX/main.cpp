@@ -32,52 +32,344 @@ extern void loop();
 #include <stdarg.h>
 #include "../shared/Delay.h"
 #include "hardware/IOLoggerCSV.h"
+#include "hardware/IOLoggerBinary.h"
 #include "hardware/Heater.h"
 #include "hardware/LinearAxis.h"
 
-// simple stdout / stdin implementation for fake serial port
-void write_serial_thread() {
-  for (;;) {
-    for (std::size_t i = usb_serial.transmit_buffer.available(); i > 0; i--) {
-      fputc(usb_serial.transmit_buffer.read(), stdout);
+#include <unistd.h>
+#include <poll.h>
+#include <chrono>
+
+#ifdef LINUX_VIRTUAL_TIME
+  #include "hardware/Scheduler.h"
+  #include "../../gcode/queue.h"
+  #include "../../module/planner.h"
+  #if ENABLED(INPUT_SHAPING)
+    #include "../../feature/input_shaping.h"
+  #endif
+#else
+  #include <atomic>
+  #include <errno.h>
+  #include <fcntl.h>
+  #include <termios.h>
+  #include <netinet/in.h>
+  #include <netinet/tcp.h>
+  #include <sys/socket.h>
+#endif
+
+#define SIMULATION_UPDATE_NS 500000 // Peripheral update period, 2kHz
+
+#ifdef LINUX_VIRTUAL_TIME
+
+  static bool input_finished = false;
+
+  /**
+   * Motion pipeline throughput, reported when the simulation ends.
+   * Counts are exact. Rates are per second of host time from the first
+   * command on, so they measure how fast the firmware code runs.
+   * Starvation is the longest stretch of virtual time the planner queue
+   * sat empty while commands were pending.
+   */
+  static struct {
+    uint32_t commands, blocks;
+    uint8_t last_head;
+    bool moved, starving;
+    uint64_t starved_since, peak_starvation;
+    std::chrono::steady_clock::time_point host_start;
+  } stats;
+
+  // Blocks are counted as the head advances. The main loop idles before the
+  // queue can fill, so the head can't lap the last sample in between.
+  static void count_blocks() {
+    const uint8_t head = planner.block_buffer_head;
+    stats.blocks += BLOCK_MOD(head - stats.last_head);
+    stats.last_head = head;
+  }
+
+  static void watch_starvation() {
+    if (planner.has_blocks_queued()) {
+      if (stats.starving) NOLESS(stats.peak_starvation, Scheduler::now() - stats.starved_since);
+      stats.moved = true;
+      stats.starving = false;
+    }
+    else if (stats.moved && !stats.starving && (queue.length || !input_finished)) {
+      stats.starving = true;
+      stats.starved_since = Scheduler::now();
     }
-    std::this_thread::yield();
   }
-}
 
-void read_serial_thread() {
-  char buffer[255] = {};
-  for (;;) {
-    std::size_t len = _MIN(usb_serial.receive_buffer.free(), 254U);
-    if (fgets(buffer, len, stdin))
-      for (std::size_t i = 0; i < strlen(buffer); i++)
-        usb_serial.receive_buffer.write(buffer[i]);
-    std::this_thread::yield();
+  /**
+   * Fill the receive buffer straight from stdin whenever the firmware has
+   * room for more. A file or pipe is read blocking, so the firmware sees
+   * the same bytes at the same virtual time on every run. A terminal is
+   * only read when a line is ready so the machine keeps running meanwhile.
+   */
+  static void read_serial_virtual() {
+    static const bool interactive = isatty(fileno(stdin));
+    if (input_finished) return;
+    const std::size_t len = _MIN(usb_serial.receive_buffer.free(), 254U);
+    if (len < 2) return;
+    if (interactive) {
+      pollfd pfd = { fileno(stdin), POLLIN, 0 };
+      if (poll(&pfd, 1, 0) <= 0) return;
+    }
+    // Read up to the end of a line, like fgets, but keep any NUL bytes
+    char buffer[255];
+    std::size_t n = 0;
+    for (int c; n < len - 1 && (c = getc(stdin)) != EOF;)
+      if ((buffer[n++] = c) == '\n') break;
+    if (n) {
+      // A line may arrive in pieces. Count it once, unless it's blank or only a comment.
+      static bool line_start = true;
+      if (line_start) {
+        std::size_t i = 0;
+        while (i < n && (buffer[i] == ' ' || buffer[i] == '\t')) i++;
+        const char c = i < n ? buffer[i] : '\0';
+        if (c && c != ';' && c != '\n' && c != '\r' && !stats.commands++)
+          stats.host_start = std::chrono::steady_clock::now();
+      }
+      line_start = (buffer[n - 1] == '\n');
+      usb_serial.receive_buffer.write((uint8_t*)buffer, n);
+    }
+    else
+      input_finished = true;
   }
-}
 
-void simulation_loop() {
-  Heater hotend(HEATER_0_PIN, TEMP_0_PIN);
-  Heater bed(HEATER_BED_PIN, TEMP_BED_PIN);
-  LinearAxis x_axis(X_ENABLE_PIN, X_DIR_PIN, X_STEP_PIN, X_MIN_PIN, X_MAX_PIN);
-  LinearAxis y_axis(Y_ENABLE_PIN, Y_DIR_PIN, Y_STEP_PIN, Y_MIN_PIN, Y_MAX_PIN);
-  LinearAxis z_axis(Z_ENABLE_PIN, Z_DIR_PIN, Z_STEP_PIN, Z_MIN_PIN, Z_MAX_PIN);
-  LinearAxis extruder0(E0_ENABLE_PIN, E0_DIR_PIN, E0_STEP_PIN, P_NC, P_NC);
+  void HAL_idletask() {
+    count_blocks();
+    read_serial_virtual();
+    usb_serial.flushTX();
+    Scheduler::yield();
+  }
 
-  //#define GPIO_LOGGING // Full GPIO and Positional Logging
+#else
 
-  #ifdef GPIO_LOGGING
-    IOLoggerCSV logger("all_gpio_log.csv");
-    Gpio::attachLogger(&logger);
+  /**
+   * The host end of the fake serial port. By default it's stdin / stdout.
+   *
+   *   pty        A pseudo-terminal for host software to open like a USB port
+   *   pty:LINK   ...with a symlink to it at LINK, so its name is known
+   *   tcp:PORT   A TCP port on localhost, for one connection at a time
+   */
+  class SerialPort {
+  public:
+    bool open(const char *spec) {
+      if (!spec) return true;
+      if (!strncmp(spec, "pty", 3) && (!spec[3] || spec[3] == ':')) return open_pty(spec[3] ? spec + 4 : nullptr);
+      if (!strncmp(spec, "tcp:", 4)) return open_tcp(atoi(spec + 4));
+      fprintf(stderr, "Usage: marlin [pty | pty:LINK | tcp:PORT]\n");
+      return false;
+    }
 
-    std::ofstream position_log;
-    position_log.open("axis_position_log.csv");
+    // Wait for input and read as much as there is, up to n bytes. 0 at end of input.
+    ssize_t receive(uint8_t *buffer, const std::size_t n) {
+      for (;;) {
+        if (listener >= 0 && fd_in < 0) accept_client();
+        pollfd pfd = { fd_in, POLLIN, 0 };
+        if (poll(&pfd, 1, -1) < 0) continue;
+        const ssize_t got = read(fd_in, buffer, n);
+        if (got > 0) return got;
+        if (got < 0 && (errno == EINTR || errno == EAGAIN)) continue;
+        if (listener < 0) return 0;
+        fprintf(stderr, "Serial port: Host disconnected\n");
+        const int fd = fd_in;
+        fd_in = fd_out = -1;      // Output is dropped until the next connection
+        close(fd);
+      }
+    }
+
+    // Write it all unless the host has gone away or stops reading for a second
+    void send(const uint8_t *buffer, std::size_t n) {
+      while (n) {
+        const int fd = fd_out;
+        if (fd < 0) return;
+        pollfd pfd = { fd, POLLOUT, 0 };
+        if (poll(&pfd, 1, 1000) <= 0) return;
+        const ssize_t sent = write(fd, buffer, n);
+        if (sent < 0) {
+          if (errno == EINTR || errno == EAGAIN) continue;
+          return;
+        }
+        buffer += sent;
+        n -= sent;
+      }
+    }
+
+  private:
+    std::atomic<int> fd_in { STDIN_FILENO }, fd_out { STDOUT_FILENO };
+    int listener = -1;
+
+    bool open_pty(const char *link) {
+      const int master = posix_openpt(O_RDWR | O_NOCTTY);
+      if (master < 0 || grantpt(master) || unlockpt(master)) { perror("pty"); return false; }
+      const char *name = ptsname(master);
+
+      // Keep the other end open so the pty lasts between host connections.
+      // Raw mode, so bytes pass through unchanged.
+      const int slave = ::open(name, O_RDWR | O_NOCTTY);
+      termios tio;
+      if (slave < 0 || tcgetattr(slave, &tio)) { perror(name); return false; }
+      cfmakeraw(&tio);
+      tcsetattr(slave, TCSANOW, &tio);
+      fcntl(master, F_SETFL, O_NONBLOCK);   // For send(). receive() reads only when there's data.
+
+      if (link) {
+        unlink(link);
+        if (symlink(name, link)) { perror(link); return false; }
+      }
+      fprintf(stderr, "Serial port: %s\n", link ?: name);
+      fd_in = fd_out = master;
+      return true;
+    }
+
+    bool open_tcp(const int port) {
+      listener = socket(AF_INET, SOCK_STREAM, 0);
+      const int on = 1;
+      setsockopt(listener, SOL_SOCKET, SO_REUSEADDR, &on, sizeof(on));
+      sockaddr_in addr = {};
+      addr.sin_family = AF_INET;
+      addr.sin_port = htons(port);
+      addr.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+      if (listener < 0 || !WITHIN(port, 1, 65535) || bind(listener, (sockaddr*)&addr, sizeof(addr)) || listen(listener, 1)) {
+        perror("tcp");
+        return false;
+      }
+      fprintf(stderr, "Serial port: 127.0.0.1:%d\n", port);
+      fd_in = fd_out = -1;
+      return true;
+    }
+
+    void accept_client() {
+      int fd;
+      while ((fd = accept(listener, nullptr, nullptr)) < 0) { /* EINTR */ }
+      const int on = 1;
+      setsockopt(fd, IPPROTO_TCP, TCP_NODELAY, &on, sizeof(on));   // Don't hold back an "ok"
+      fprintf(stderr, "Serial port: Host connected\n");
+      fd_in = fd_out = fd;
+    }
+  };
 
-    int32_t x,y,z;
+  static SerialPort serial_port;
+
+  // Send the firmware's output in bulk whenever there's a line or more
+  void write_serial_thread() {
+    uint8_t chunk[128];
+    for (;;) {
+      usb_serial.tx_data.wait([]{ return !usb_serial.transmit_buffer.empty(); });
+      const uint32_t n = usb_serial.transmit_buffer.read(chunk, sizeof(chunk));
+      usb_serial.tx_space.notify();
+      serial_port.send(chunk, n);
+    }
+  }
+
+  // Pass on the host's input as it arrives, as much as the firmware has room for
+  void read_serial_thread() {
+    uint8_t chunk[128];
+    for (;;) {
+      usb_serial.rx_space.wait([]{ return !usb_serial.receive_buffer.full(); });
+      const ssize_t n = serial_port.receive(chunk, _MIN(usb_serial.receive_buffer.free(), sizeof(chunk)));
+      if (n == 0) return;   // End of stdin
+      usb_serial.receive_buffer.write(chunk, n);
+    }
+  }
+
+#endif
+
+//#define GPIO_LOGGING    // Full GPIO and Positional Logging
+//#define GPIO_TRACE      // Every GPIO event to gpio_trace.bin, for buildroot/share/scripts/gpio_trace.py
+//#define SHAPING_LOGGING // X/Y step timelines before and after input shaping
+
+#if ENABLED(INPUT_SHAPING)
+
+  #if defined(SHAPING_LOGGING) && !defined(GPIO_LOGGING) && !defined(GPIO_TRACE)
+    #define HAS_SHAPING_LOGGER 1
   #endif
 
-  for (;;) {
+  #if HAS_SHAPING_LOGGER
+
+    /**
+     * Log the X/Y steps to two files in the same CSV format: as planned, and
+     * as sent to the pins by input shaping. Each has a RISE of the STEP pin
+     * per step and a RISE or FALL of the DIR pin where the direction changes.
+     */
+    class ShapingLogger : public IOLogger {
+    public:
+      ShapingLogger() : planned("unshaped_steps_log.csv"), shaped("shaped_steps_log.csv"), planned_dir{0} {}
 
+      // Pin changes from Gpio
+      void log(GpioEvent ev) {
+        if (ev.pin_id == X_STEP_PIN || ev.pin_id == Y_STEP_PIN) {
+          if (ev.event == GpioEvent::RISE) shaped.log(ev);
+        }
+        else if (ev.pin_id == X_DIR_PIN || ev.pin_id == Y_DIR_PIN) {
+          if (ev.event == GpioEvent::RISE || ev.event == GpioEvent::FALL) shaped.log(ev);
+        }
+      }
+
+      // Steps from the Stepper ISR, before shaping
+      void planned_step(const uint8_t axis, const bool reverse) {
+        const uint64_t now = Clock::nanos();
+        const bool dir = reverse ? (axis ? INVERT_Y_DIR : INVERT_X_DIR) : !(axis ? INVERT_Y_DIR : INVERT_X_DIR);
+        if (dir != planned_dir[axis]) {
+          planned_dir[axis] = dir;
+          planned.log(GpioEvent(now, axis ? Y_DIR_PIN : X_DIR_PIN, dir ? GpioEvent::RISE : GpioEvent::FALL));
+        }
+        planned.log(GpioEvent(now, axis ? Y_STEP_PIN : X_STEP_PIN, GpioEvent::RISE));
+      }
+
+      void flush() { planned.flush(); shaped.flush(); }
+
+    private:
+      IOLoggerCSV planned, shaped;
+      bool planned_dir[2];
+    };
+
+    static ShapingLogger *shaping_logger = nullptr;
+
+  #endif
+
+  void HAL_shaping_trace(const uint8_t axis, const bool reverse) {
+    #if HAS_SHAPING_LOGGER
+      if (shaping_logger) shaping_logger->planned_step(axis, reverse);
+    #else
+      UNUSED(axis); UNUSED(reverse);
+    #endif
+  }
+
+#endif // INPUT_SHAPING
+
+class Simulation {
+public:
+  Simulation() :
+    hotend(HEATER_0_PIN, TEMP_0_PIN),
+    bed(HEATER_BED_PIN, TEMP_BED_PIN),
+    x_axis(X_ENABLE_PIN, X_DIR_PIN, X_STEP_PIN, X_MIN_PIN, X_MAX_PIN),
+    y_axis(Y_ENABLE_PIN, Y_DIR_PIN, Y_STEP_PIN, Y_MIN_PIN, Y_MAX_PIN),
+    z_axis(Z_ENABLE_PIN, Z_DIR_PIN, Z_STEP_PIN, Z_MIN_PIN, Z_MAX_PIN),
+    extruder0(E0_ENABLE_PIN, E0_DIR_PIN, E0_STEP_PIN, P_NC, P_NC)
+    #ifdef GPIO_LOGGING
+      , logger("all_gpio_log.csv"), x(0), y(0), z(0)
+    #elif defined(GPIO_TRACE)
+      , trace("gpio_trace.bin", {
+          { 'X', INVERT_X_DIR, X_ENABLE_ON, X_STEP_PIN, X_DIR_PIN, X_ENABLE_PIN, steps_per_mm[X_AXIS] },
+          { 'Y', INVERT_Y_DIR, Y_ENABLE_ON, Y_STEP_PIN, Y_DIR_PIN, Y_ENABLE_PIN, steps_per_mm[Y_AXIS] },
+          { 'Z', INVERT_Z_DIR, Z_ENABLE_ON, Z_STEP_PIN, Z_DIR_PIN, Z_ENABLE_PIN, steps_per_mm[Z_AXIS] },
+          { 'E', INVERT_E0_DIR, E_ENABLE_ON, E0_STEP_PIN, E0_DIR_PIN, E0_ENABLE_PIN, steps_per_mm[E_AXIS] }
+        })
+    #endif
+  {
+    #ifdef GPIO_LOGGING
+      Gpio::attachLogger(&logger);
+      position_log.open("axis_position_log.csv");
+    #elif defined(GPIO_TRACE)
+      Gpio::attachLogger(&trace);
+    #elif HAS_SHAPING_LOGGER
+      Gpio::attachLogger(&shaping_log);
+      shaping_logger = &shaping_log;
+    #endif
+  }
+
+  void update() {
     hotend.update();
     bed.update();
 
@@ -88,24 +380,65 @@ void simulation_loop() {
 
     #ifdef GPIO_LOGGING
       if (x_axis.position != x || y_axis.position != y || z_axis.position != z) {
-        uint64_t update = MAX3(x_axis.last_update, y_axis.last_update, z_axis.last_update);
-        position_log << update << ", " << x_axis.position << ", " << y_axis.position << ", " << z_axis.position << std::endl;
-        position_log.flush();
+        uint64_t update = _MAX(x_axis.last_update, y_axis.last_update, z_axis.last_update);
+        position_log << update << ", " << x_axis.position << ", " << y_axis.position << ", " << z_axis.position << '\n';
         x = x_axis.position;
         y = y_axis.position;
         z = z_axis.position;
       }
       // flush the logger
       logger.flush();
+    #elif defined(GPIO_TRACE) && !defined(LINUX_VIRTUAL_TIME)
+      trace.flush();  // A real time run is stopped by killing it
+    #elif HAS_SHAPING_LOGGER
+      shaping_log.flush();
     #endif
+  }
 
-    std::this_thread::yield();
+  uint64_t steps() {
+    return x_axis.step_count + y_axis.step_count + z_axis.step_count + extruder0.step_count;
   }
-}
 
-int main() {
-  std::thread write_serial (write_serial_thread);
-  std::thread read_serial (read_serial_thread);
+private:
+  Heater hotend, bed;
+  LinearAxis x_axis, y_axis, z_axis, extruder0;
+
+  #ifdef GPIO_LOGGING
+    IOLoggerCSV logger;
+    std::ofstream position_log;
+    int32_t x, y, z;
+  #elif defined(GPIO_TRACE)
+    static constexpr float steps_per_mm[] = DEFAULT_AXIS_STEPS_PER_UNIT;
+    IOLoggerBinary trace;
+  #elif HAS_SHAPING_LOGGER
+    ShapingLogger shaping_log;
+  #endif
+};
+
+#ifndef LINUX_VIRTUAL_TIME
+
+  // Steppers are updated as their pins change, so only the heaters need this
+  void simulation_loop() {
+    Simulation sim;
+    for (;;) {
+      sim.update();
+      std::this_thread::sleep_for(std::chrono::nanoseconds(SIMULATION_UPDATE_NS));
+    }
+  }
+
+#endif
+
+int main(int argc, char *argv[]) {
+  #ifdef LINUX_VIRTUAL_TIME
+    if (argc > 1) {
+      fprintf(stderr, "The serial port is stdin / stdout with LINUX_VIRTUAL_TIME\n");
+      return 1;
+    }
+  #else
+    if (argc > 2 || !serial_port.open(argc > 1 ? argv[1] : nullptr)) return 1;
+    std::thread write_serial (write_serial_thread);
+    std::thread read_serial (read_serial_thread);
+  #endif
 
   #if NUM_SERIAL > 0
     MYSERIAL0.begin(BAUDRATE);
@@ -118,19 +451,53 @@ int main() {
 
   HAL_timer_init();
 
-  std::thread simulation (simulation_loop);
+  #ifdef LINUX_VIRTUAL_TIME
 
-  DELAY_US(10000);
+    // Timers were attached first so they win ties with the peripherals
+    Simulation sim;
+    PeriodicTask sim_task(SIMULATION_UPDATE_NS, [&sim]{ sim.update(); watch_starvation(); });
+    Scheduler::attach(&sim_task);
 
-  setup();
-  for (;;) {
-    loop();
-    std::this_thread::yield();
-  }
+    DELAY_US(10000);
 
-  simulation.join();
-  write_serial.join();
-  read_serial.join();
+    setup();
+
+    // Run until the input is exhausted and every queued move has been stepped
+    while (!input_finished || queue.length || planner.has_blocks_queued() || !TERN1(INPUT_SHAPING, input_shaping.idle()))
+      loop();
+
+    count_blocks();
+    const double host_s = stats.commands ? std::chrono::duration<double>(std::chrono::steady_clock::now() - stats.host_start).count() : 0;
+    const unsigned long long steps = sim.steps();
+    auto per_second = [host_s](const double n) { return host_s > 0 ? n / host_s : 0; };
+
+    usb_serial.flushTX();
+    fflush(stdout);
+    fprintf(stderr, "Simulated %.3fs of virtual time, %llu events\n",
+      Scheduler::now() / 1000000000.0, (unsigned long long)Scheduler::eventsFired());
+    fprintf(stderr, "Benchmark: %u commands, %u blocks, %llu steps in %.3fs of host time\n",
+      stats.commands, stats.blocks, steps, host_s);
+    fprintf(stderr, "Benchmark: %.0f commands/s, %.0f blocks/s, %.0f steps/s, peak starvation %.1fms\n",
+      per_second(stats.commands), per_second(stats.blocks), per_second(steps), stats.peak_starvation / 1000000.0);
+    return 0;
+
+  #else
+
+    std::thread simulation (simulation_loop);
+
+    DELAY_US(10000);
+
+    setup();
+    for (;;) {
+      loop();
+      std::this_thread::yield();
+    }
+
+    simulation.join();
+    write_serial.join();
+    read_serial.join();
+
+  #endif
 }
 
 #endif // __PLAT_LINUX__
@@ -68,10 +68,13 @@ bool PersistentStore::write_data(int &pos, const uint8_t *value, size_t size, ui
   while (size--) {
     const uint8_t v = *value;
     SYNC(NVMCTRL->SEESTAT.bit.BUSY);
-    if (NVMCTRL->INTFLAG.bit.SEESFULL)
-      NVMCTRL_FLUSH();      // Next write will trigger a sector reallocation. I need to flush 'pagebuffer'
-    ((volatile uint8_t *)SEEPROM_ADDR)[pos] = v;
-    SYNC(!NVMCTRL->INTFLAG.bit.SEEWRC);
+    // Every write uses up SmartEEPROM space, so skip bytes that are unchanged
+    if (((volatile uint8_t *)SEEPROM_ADDR)[pos] != v) {
+      if (NVMCTRL->INTFLAG.bit.SEESFULL)
+        NVMCTRL_FLUSH();      // Next write will trigger a sector reallocation. I need to flush 'pagebuffer'
+      ((volatile uint8_t *)SEEPROM_ADDR)[pos] = v;
+      SYNC(!NVMCTRL->INTFLAG.bit.SEEWRC);
+    }
     crc16(crc, &v, 1);
     pos++;
     value++;
@@ -43,9 +43,15 @@ size_t PersistentStore::capacity() { return MARLIN_EEPROM_SIZE; }
 #define _ALIGN(x) __attribute__ ((aligned(x)))
 static char _ALIGN(4) HAL_eeprom_data[MARLIN_EEPROM_SIZE];
 
+// The span of bytes changed since access_start. Only these are written back.
+static int dirty_start, dirty_end;
+
 bool PersistentStore::access_start() {
   if (!card.isMounted()) return false;
 
+  dirty_start = MARLIN_EEPROM_SIZE;
+  dirty_end = 0;
+
   SdFile file, root = card.getroot();
   if (!file.open(&root, EEPROM_FILENAME, O_RDONLY))
     return true;
@@ -61,18 +67,29 @@ bool PersistentStore::access_start() {
 bool PersistentStore::access_finish() {
   if (!card.isMounted()) return false;
 
+  if (dirty_start >= dirty_end) return true;   // Nothing changed
+
   SdFile file, root = card.getroot();
-  int bytes_written = 0;
-  if (file.open(&root, EEPROM_FILENAME, O_CREAT | O_WRITE | O_TRUNC)) {
-    bytes_written = file.write(HAL_eeprom_data, MARLIN_EEPROM_SIZE);
+  bool ok = false;
+  if (file.open(&root, EEPROM_FILENAME, O_CREAT | O_WRITE)) {
+    // A new or short file gets everything, otherwise just the changes
+    if (file.fileSize() < MARLIN_EEPROM_SIZE) { dirty_start = 0; dirty_end = MARLIN_EEPROM_SIZE; }
+    const int len = dirty_end - dirty_start;
+    ok = file.seekSet(dirty_start) && file.write(&HAL_eeprom_data[dirty_start], len) == len;
     file.close();
   }
-  return (bytes_written == MARLIN_EEPROM_SIZE);
+  if (ok) { dirty_start = MARLIN_EEPROM_SIZE; dirty_end = 0; }
+  return ok;
 }
 
 bool PersistentStore::write_data(int &pos, const uint8_t *value, size_t size, uint16_t *crc) {
-  for (size_t i = 0; i < size; i++)
-    HAL_eeprom_data[pos + i] = value[i];
+  for (size_t i = 0; i < size; i++) {
+    if (HAL_eeprom_data[pos + i] != char(value[i])) {
+      HAL_eeprom_data[pos + i] = value[i];
+      NOMORE(dirty_start, pos + int(i));
+      NOLESS(dirty_end, pos + int(i) + 1);
+    }
+  }
   crc16(crc, value, size);
   pos += size;
   return false;
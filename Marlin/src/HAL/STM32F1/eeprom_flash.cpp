@@ -44,8 +44,11 @@
 #endif
 size_t PersistentStore::capacity() { return MARLIN_EEPROM_SIZE; }
 
+#define EEPROM_PAGES (((MARLIN_EEPROM_SIZE) + (EEPROM_PAGE_SIZE) - 1) / (EEPROM_PAGE_SIZE))
+
 static uint8_t ram_eeprom[MARLIN_EEPROM_SIZE] __attribute__((aligned(4))) = {0};
-static bool eeprom_dirty = false;
+static bool eeprom_dirty = false,
+            page_dirty[EEPROM_PAGES];   // Only pages with changes are erased and written
 
 bool PersistentStore::access_start() {
   const uint32_t* source = reinterpret_cast<const uint32_t*>(EEPROM_PAGE0_BASE);
@@ -58,33 +61,29 @@ bool PersistentStore::access_start() {
     *destination = *source;
 
   eeprom_dirty = false;
+  ZERO(page_dirty);
   return true;
 }
 
 bool PersistentStore::access_finish() {
 
   if (eeprom_dirty) {
-    FLASH_Status status;
-
-    // Instead of erasing all (both) pages, maybe in the loop we check what page we are in, and if the
-    // data has changed in that page. We then erase the first time we "detect" a change. In theory, if
-    // nothing changed in a page, we wouldn't need to erase/write it.
-    // Or, instead of checking at this point, turn eeprom_dirty into an array of bool the size of number
-    // of pages. Inside write_data, we set the flag to true at that time if something in that
-    // page changes...either way, something to look at later.
     FLASH_Unlock();
 
-    #define ACCESS_FINISHED(TF) { FLASH_Lock(); eeprom_dirty = false; return TF; }
+    #define ACCESS_FINISHED(TF) { FLASH_Lock(); eeprom_dirty = false; ZERO(page_dirty); return TF; }
+
+    LOOP_L_N(p, EEPROM_PAGES) {
+      if (!page_dirty[p]) continue;
 
-    status = FLASH_ErasePage(EEPROM_PAGE0_BASE);
-    if (status != FLASH_COMPLETE) ACCESS_FINISHED(true);
-    status = FLASH_ErasePage(EEPROM_PAGE1_BASE);
-    if (status != FLASH_COMPLETE) ACCESS_FINISHED(true);
+      const uint32_t page_base = EEPROM_PAGE0_BASE + p * (EEPROM_PAGE_SIZE);
+      if (FLASH_ErasePage(page_base) != FLASH_COMPLETE) ACCESS_FINISHED(true);
 
-    const uint16_t *source = reinterpret_cast<const uint16_t*>(ram_eeprom);
-    for (size_t i = 0; i < MARLIN_EEPROM_SIZE; i += 2, ++source) {
-      if (FLASH_ProgramHalfWord(EEPROM_PAGE0_BASE + i, *source) != FLASH_COMPLETE)
-        ACCESS_FINISHED(false);
+      const size_t start = p * (EEPROM_PAGE_SIZE), end = _MIN(start + (EEPROM_PAGE_SIZE), size_t(MARLIN_EEPROM_SIZE));
+      const uint16_t *source = reinterpret_cast<const uint16_t*>(&ram_eeprom[start]);
+      for (size_t i = start; i < end; i += 2, ++source) {
+        if (FLASH_ProgramHalfWord(EEPROM_PAGE0_BASE + i, *source) != FLASH_COMPLETE)
+          ACCESS_FINISHED(false);
+      }
     }
 
     ACCESS_FINISHED(true);
@@ -94,8 +93,13 @@ bool PersistentStore::access_finish() {
 }
 
 bool PersistentStore::write_data(int &pos, const uint8_t *value, size_t size, uint16_t *crc) {
-  for (size_t i = 0; i < size; ++i) ram_eeprom[pos + i] = value[i];
-  eeprom_dirty = true;
+  for (size_t i = 0; i < size; ++i) {
+    // Flash wears with each erase, so only flag pages that really change
+    if (ram_eeprom[pos + i] != value[i]) {
+      ram_eeprom[pos + i] = value[i];
+      page_dirty[(pos + i) / (EEPROM_PAGE_SIZE)] = eeprom_dirty = true;
+    }
+  }
   crc16(crc, value, size);
   pos += size;
   return false;  // return true for any error
@@ -172,6 +172,10 @@
   #include "feature/cancel_object.h"
 #endif
 
+#if ENABLED(PRINT_TIME_ESTIMATE)
+  #include "feature/time_estimate.h"
+#endif
+
 #if HAS_FILAMENT_SENSOR
   #include "feature/runout.h"
 #endif
@@ -423,6 +427,9 @@ void startOrResumeJob() {
     #if BOTH(LCD_SET_PROGRESS_MANUALLY, USE_M73_REMAINING_TIME)
       ui.reset_remaining_time();
     #endif
+    #if ENABLED(PRINT_TIME_ESTIMATE)
+      if (!print_job_timer.isRunning()) time_estimate.reset(); // Not for M109 during the print
+    #endif
   }
   print_job_timer.start();
 }
@@ -702,6 +709,9 @@ void idle(TERN_(ADVANCED_PAUSE_FEATURE, bool no_stepper_sleep/*=false*/)) {
     if (printJobOngoing()) recovery.outage();
   #endif
 
+  // Write the power-loss journal outside of command handling
+  TERN_(POWER_LOSS_JOURNAL, recovery.idle());
+
   // Run StallGuard endstop checks
   #if ENABLED(SPI_ENDSTOPS)
     if (endstops.tmc_spi_homing.any
@@ -722,6 +732,9 @@ void idle(TERN_(ADVANCED_PAUSE_FEATURE, bool no_stepper_sleep/*=false*/)) {
   // Update the Print Job Timer state
   TERN_(PRINTCOUNTER, print_job_timer.tick());
 
+  // Add up the move time for the print time estimate
+  TERN_(PRINT_TIME_ESTIMATE, time_estimate.tick());
+
   // Update the Beeper queue
   TERN_(USE_BEEPER, buzzer.tick());
 
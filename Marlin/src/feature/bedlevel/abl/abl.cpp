@@ -25,6 +25,9 @@
 #if ENABLED(AUTO_BED_LEVELING_BILINEAR)
 
 #include "../bedlevel.h"
+#if ENABLED(MESH_CELL_CACHE)
+  #include "../mesh_cells.h"
+#endif
 
 #include "../../../module/motion.h"
 
@@ -240,6 +243,7 @@ void print_bilinear_leveling_grid() {
 void refresh_bed_level() {
   bilinear_grid_factor = bilinear_grid_spacing.reciprocal();
   TERN_(ABL_BILINEAR_SUBDIVISION, bed_level_virt_interpolate());
+  TERN_(MESH_CELL_CACHE, refresh_mesh_cells());
 }
 
 #if ENABLED(ABL_BILINEAR_SUBDIVISION)
@@ -256,6 +260,24 @@ void refresh_bed_level() {
   #define ABL_BG_GRID(X,Y)  z_values[X][Y]
 #endif
 
+#if ENABLED(MESH_CELL_CACHE)
+
+  // Beyond the grid keep using the edge cells, or maintain height at the grid edges
+  static MeshCells<ABL_BG_POINTS_X, ABL_BG_POINTS_Y, DISABLED(EXTRAPOLATE_BEYOND_GRID), DISABLED(EXTRAPOLATE_BEYOND_GRID)> bilinear_cells;
+
+  void refresh_mesh_cells() {
+    bilinear_cells.update(bilinear_start.asFloat(), { ABL_BG_FACTOR(x), ABL_BG_FACTOR(y) },
+      [](const uint8_t x, const uint8_t y) { return ABL_BG_GRID(x, y); }
+    );
+  }
+
+  // Get the Z adjustment for non-linear bed leveling
+  float bilinear_z_offset(const xy_pos_t &raw) { return bilinear_cells.get(raw); }
+
+#endif
+
+#if DISABLED(MESH_CELL_CACHE)
+
 // Get the Z adjustment for non-linear bed leveling
 float bilinear_z_offset(const xy_pos_t &raw) {
 
@@ -340,6 +362,8 @@ float bilinear_z_offset(const xy_pos_t &raw) {
   return offset;
 }
 
+#endif // !MESH_CELL_CACHE
+
 #if IS_CARTESIAN && DISABLED(SEGMENT_LEVELED_MOVES)
 
   #define CELL_INDEX(A,V) ((V - bilinear_start.A) * ABL_BG_FACTOR(A))
@@ -35,6 +35,11 @@
   bool g29_in_progress = false;
 #endif
 
+#if ENABLED(MESH_BICUBIC)
+  #include "mesh_cells.h"
+  bool mesh_bicubic = true;
+#endif
+
 #if ENABLED(LCD_BED_LEVELING)
   #include "../../lcd/ultralcd.h"
 #endif
@@ -67,7 +72,10 @@ void set_bed_leveling_enabled(const bool enable/*=true*/) {
 
     planner.synchronize();
 
-    #if ENABLED(AUTO_BED_LEVELING_BILINEAR)
+    #if ENABLED(MESH_CELL_CACHE)
+      // Leveled moves use the cell table from here on
+      if (enable) refresh_mesh_cells();
+    #elif ENABLED(AUTO_BED_LEVELING_BILINEAR)
       // Force bilinear_z_offset to re-calculate next time
       const xyz_pos_t reset { -9999.999, -9999.999, 0 };
       (void)bilinear_z_offset(reset);
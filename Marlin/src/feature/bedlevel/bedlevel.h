@@ -33,6 +33,10 @@ bool leveling_is_valid();
 void set_bed_leveling_enabled(const bool enable=true);
 void reset_bed_level();
 
+#if ENABLED(MESH_CELL_CACHE)
+  void refresh_mesh_cells();
+#endif
+
 #if ENABLED(ENABLE_LEVELING_FADE_HEIGHT)
   void set_z_fade_height(const float zfh, const bool do_report=true);
 #endif
@@ -0,0 +1,221 @@
+/**
+ * Marlin 3D Printer Firmware
+ * Copyright (c) 2020 MarlinFirmware [https://github.com/MarlinFirmware/Marlin]
+ *
+ * Based on Sprinter and grbl.
+ * Copyright (c) 2011 Camiel Gubbels / Erik van der Zalm
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+#pragma once
+
+/**
+ * mesh_cells.h - Bilinear coefficients for each cell of a leveling mesh
+ *
+ * Within a cell, with u and v the X and Y position as a fraction of the cell,
+ *
+ *   z = z0 + dx * u + dy * v + dxy * u * v
+ *
+ * The table is rebuilt whenever the mesh changes (see refresh_mesh_cells)
+ * so a Z correction is just a cell lookup and three multiply-adds.
+ * Cells are stored row by row, so moves along X read them in order.
+ *
+ * With MESH_BICUBIC each cell holds a bicubic patch instead,
+ *
+ *   z = sum of a[i][j] * u^i * v^j for i, j = 0 to 3
+ *
+ * made from Catmull-Rom splines through the 4x4 mesh points around
+ * the cell, as ABL_BILINEAR_SUBDIVISION uses. Patches meet with matching
+ * slopes, so a coarse mesh gives a smooth surface. (M420 B0 fills the
+ * same table with bilinear cells.)
+ */
+
+#include "../../inc/MarlinConfig.h"
+
+#if ENABLED(MESH_BICUBIC)
+  typedef struct { float a[4][4]; } mesh_cell_t;  // a[power of u][power of v]
+  extern bool mesh_bicubic;                       // Bicubic cells, else bilinear
+#else
+  typedef struct { float z0, dx, dy, dxy; } mesh_cell_t;
+#endif
+
+/**
+ * PX, PY       - Mesh points on each axis
+ * CLAMP_LOW    - Hold the edge height before the first mesh line
+ * CLAMP_HIGH   - Hold the edge height past the last mesh line
+ */
+template<uint8_t PX, uint8_t PY, bool CLAMP_LOW, bool CLAMP_HIGH>
+class MeshCells {
+public:
+  static constexpr uint8_t CX = PX - 1, CY = PY - 1;
+
+  xy_pos_t start;                 // Position of the first mesh point
+  xy_float_t factor;              // Cells per mm
+  mesh_cell_t cell[CY][CX];
+
+  /**
+   * Rebuild the table from the mesh. A cell with an unknown (NAN)
+   * corner gives no correction at all.
+   */
+  template<typename F>
+  void update(const xy_pos_t &mesh_start, const xy_float_t &cells_per_mm, F z) {
+    start = mesh_start;
+    factor = cells_per_mm;
+    #if ENABLED(MESH_BICUBIC)
+      if (mesh_bicubic) {
+        LOOP_L_N(y, CY) LOOP_L_N(x, CX) update_bicubic(cell[y][x], x, y, z);
+        return;
+      }
+    #endif
+    LOOP_L_N(y, CY) LOOP_L_N(x, CX) {
+      const float z00 = z(x, y), z10 = z(x + 1, y), z01 = z(x, y + 1), z11 = z(x + 1, y + 1);
+      mesh_cell_t &c = cell[y][x];
+      #if ENABLED(MESH_BICUBIC)
+        ZERO(c.a);
+        if (!isnan(z00) && !isnan(z10) && !isnan(z01) && !isnan(z11)) {
+          c.a[0][0] = z00;
+          c.a[1][0] = z10 - z00;
+          c.a[0][1] = z01 - z00;
+          c.a[1][1] = z11 - z10 - z01 + z00;
+        }
+      #else
+        if (isnan(z00) || isnan(z10) || isnan(z01) || isnan(z11))
+          c.z0 = c.dx = c.dy = c.dxy = 0;
+        else {
+          c.z0 = z00;
+          c.dx = z10 - z00;
+          c.dy = z01 - z00;
+          c.dxy = z11 - z10 - z01 + z00;
+        }
+      #endif
+    }
+  }
+
+  // Z correction at a single point
+  FORCE_INLINE float get(const xy_pos_t &raw) const {
+    xy_float_t r = (raw - start) * factor;
+    const uint8_t ix = locate(r.x, CX), iy = locate(r.y, CY);
+    return value(cell[iy][ix], r.x, r.y);
+  }
+
+  /**
+   * Z corrections for the points raw + step * i of a segmented line,
+   * i = 1 to count. While the points stay in one cell their position
+   * in the cell is stepped along instead of being worked out again.
+   */
+  void get_line(xy_pos_t raw, const xy_pos_t &step, uint8_t count, float *out) const {
+    const xy_float_t d = step * factor;
+    raw += step;
+    while (count) {
+      xy_float_t r = (raw - start) * factor;
+      const uint8_t ix = locate(r.x, CX), iy = locate(r.y, CY);
+      const mesh_cell_t &c = cell[iy][ix];
+      // The cells at the edge reach out past the mesh
+      const float ulo = ix ? 0 : -1e9f, uhi = ix < CX - 1 ? 1 : 1e9f,
+                  vlo = iy ? 0 : -1e9f, vhi = iy < CY - 1 ? 1 : 1e9f;
+      do {
+        *out++ = value(c, r.x, r.y);
+        raw += step;
+        r += d;
+      } while (--count && WITHIN(r.x, ulo, uhi) && WITHIN(r.y, vlo, vhi));
+    }
+  }
+
+private:
+  #if ENABLED(MESH_BICUBIC)
+
+    // Catmull-Rom coefficients of t^0..t^3 for the span p1-p2
+    static void catmull_rom(float c[4], const float p0, const float p1, const float p2, const float p3) {
+      c[0] = p1;
+      c[1] = 0.5f * (p2 - p0);
+      c[2] = p0 - 2.5f * p1 + 2.0f * p2 - 0.5f * p3;
+      c[3] = 0.5f * (3.0f * (p1 - p2) + p3 - p0);
+    }
+
+    /**
+     * Fit the patch for cell (cx, cy) to the mesh points around it.
+     * A point that is off the mesh or unknown (NAN) is extrapolated in a
+     * straight line from the two points next to it, first along X, then Y.
+     */
+    template<typename F>
+    static void update_bicubic(mesh_cell_t &c, const uint8_t cx, const uint8_t cy, F z) {
+      float p[4][4];  // p[y][x]
+      LOOP_L_N(j, 4) LOOP_L_N(i, 4) {
+        const int8_t x = cx + i - 1, y = cy + j - 1;
+        p[j][i] = WITHIN(x, 0, PX - 1) && WITHIN(y, 0, PY - 1) ? z(x, y) : NAN;
+      }
+
+      // A cell with an unknown corner gives no correction, as above
+      if (isnan(p[1][1]) || isnan(p[1][2]) || isnan(p[2][1]) || isnan(p[2][2])) { ZERO(c.a); return; }
+
+      LOOP_L_N(j, 4) {
+        if (isnan(p[j][0])) p[j][0] = 2 * p[j][1] - p[j][2];
+        if (isnan(p[j][3])) p[j][3] = 2 * p[j][2] - p[j][1];
+      }
+      LOOP_L_N(i, 4) {
+        if (isnan(p[0][i])) p[0][i] = 2 * p[1][i] - p[2][i];
+        if (isnan(p[3][i])) p[3][i] = 2 * p[2][i] - p[1][i];
+      }
+
+      // Spline each row along X, then each power of u along Y
+      float row[4][4];  // row[y][power of u]
+      LOOP_L_N(j, 4) catmull_rom(row[j], p[j][0], p[j][1], p[j][2], p[j][3]);
+      LOOP_L_N(i, 4) catmull_rom(c.a[i], row[0][i], row[1][i], row[2][i], row[3][i]);
+    }
+
+  #endif
+
+  // Cell index on one axis. Leave the fraction in the cell in 'r'.
+  static FORCE_INLINE uint8_t locate(float &r, const uint8_t cells) {
+    const int16_t i = constrain(int16_t(FLOOR(r)), 0, cells - 1);
+    r -= i;
+    return i;
+  }
+
+  #if ENABLED(MESH_BICUBIC)
+
+    static float value(const mesh_cell_t &c, float u, float v) {
+      if (CLAMP_LOW)  { NOLESS(u, 0); NOLESS(v, 0); }
+      if (CLAMP_HIGH) { NOMORE(u, 1); NOMORE(v, 1); }
+
+      // Past the edge of the mesh go on in a straight line. A cubic would run away.
+      const float uc = constrain(u, 0, 1), vc = constrain(v, 0, 1),
+                  du = u - uc, dv = v - vc;
+
+      float r[4], z = 0;
+      for (int8_t j = 3; j >= 0; j--) {
+        r[j] = ((c.a[3][j] * uc + c.a[2][j]) * uc + c.a[1][j]) * uc + c.a[0][j];
+        z = z * vc + r[j];
+      }
+      if (dv) z += dv * ((3 * r[3] * vc + 2 * r[2]) * vc + r[1]);
+      if (du) {
+        float zu = 0;
+        for (int8_t j = 3; j >= 0; j--)
+          zu = zu * vc + (3 * c.a[3][j] * uc + 2 * c.a[2][j]) * uc + c.a[1][j];
+        z += du * zu;
+      }
+      return z;
+    }
+
+  #else
+
+    static FORCE_INLINE float value(const mesh_cell_t &c, float u, float v) {
+      if (CLAMP_LOW)  { NOLESS(u, 0); NOLESS(v, 0); }
+      if (CLAMP_HIGH) { NOMORE(u, 1); NOMORE(v, 1); }
+      return c.z0 + c.dx * u + (c.dy + c.dxy * u) * v;
+    }
+
+  #endif
+};
@@ -0,0 +1,127 @@
+/**
+ * Marlin 3D Printer Firmware
+ * Copyright (c) 2020 MarlinFirmware [https://github.com/MarlinFirmware/Marlin]
+ *
+ * Based on Sprinter and grbl.
+ * Copyright (c) 2011 Camiel Gubbels / Erik van der Zalm
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+
+#include "../../inc/MarlinConfig.h"
+
+#if ENABLED(PROBE_ROUTE)
+
+#include "probe_route.h"
+#include "../../module/motion.h"
+
+void ProbeRoute::reverse(uint8_t i, uint8_t j) {
+  for (; i < j; i++, j--) {
+    const xy_uint8_t p = point[i];
+    point[i] = point[j];
+    point[j] = p;
+  }
+}
+
+float ProbeRoute::travel(const xy_pos_t &start) const {
+  float t = 0;
+  xy_pos_t here = start;
+  LOOP_L_N(i, count) {
+    const xy_pos_t p = pos(i);
+    t += (p - here).magnitude();
+    here = p;
+  }
+  return t;
+}
+
+float ProbeRoute::plan(const xy_pos_t &start) {
+  if (!count) return 0;
+
+  // The points as added, run either way, are the fallback
+  xy_uint8_t added[GRID_MAX_POINTS];
+  COPY(added, point);
+  const float added_travel = travel(start),
+              reversed_travel = added_travel - (pos(0) - start).magnitude() + (pos(count - 1) - start).magnitude();
+
+  // Go to the nearest point each time
+  xy_pos_t here = start;
+  LOOP_L_N(i, count) {
+    uint8_t best = i;
+    float best_d2 = 1e30f;
+    for (uint8_t j = i; j < count; j++) {
+      const xy_pos_t d = pos(j) - here;
+      const float d2 = sq(d.x) + sq(d.y);   // no sqrt needed to compare
+      if (d2 < best_d2) { best_d2 = d2; best = j; }
+    }
+    const xy_uint8_t p = point[i];
+    point[i] = point[best];
+    point[best] = p;
+    here = pos(i);
+  }
+
+  // Greedy routes can leave stragglers. Keep a serpentine if that's shorter.
+  if (_MIN(added_travel, reversed_travel) < travel(start)) {
+    COPY(point, added);
+    if (reversed_travel < added_travel) reverse(0, count - 1);
+  }
+
+  // 2-opt: Reverse point[i..j] if that shortens the route. Route ends are open.
+  LOOP_L_N(pass, PROBE_ROUTE_PASSES) {
+    bool improved = false;
+    for (uint8_t i = 0; i + 1 < count; i++) {
+      const xy_pos_t a = i ? pos(i - 1) : start;
+      xy_pos_t b = pos(i);
+      float ab = (b - a).magnitude();
+      for (uint8_t j = i + 1; j < count; j++) {
+        const xy_pos_t c = pos(j);
+        float before = ab, after = (c - a).magnitude();
+        if (j + 1 < count) {
+          const xy_pos_t d = pos(j + 1);
+          before += (d - c).magnitude();
+          after += (d - b).magnitude();
+        }
+        if (after < before - 0.01f) {   // Ignore ties, common on a regular grid
+          reverse(i, j);
+          b = c;
+          ab = (b - a).magnitude();
+          improved = true;
+        }
+      }
+    }
+    if (!improved) break;
+  }
+
+  return travel(start);
+}
+
+void ProbeRoute::report(const float mm) const {
+  // Z moves for each point: the probe itself and the raise after it
+  constexpr float fast = MMM_TO_MMS(Z_PROBE_SPEED_FAST), slow = MMM_TO_MMS(Z_PROBE_SPEED_SLOW),
+                  per_point = (Z_CLEARANCE_BETWEEN_PROBES) / fast
+    #if TOTAL_PROBING == 2
+                  + (Z_CLEARANCE_BETWEEN_PROBES) / fast + (Z_CLEARANCE_MULTI_PROBE) / fast + (Z_CLEARANCE_MULTI_PROBE) / slow
+    #elif TOTAL_PROBING > 2
+                  + (Z_CLEARANCE_BETWEEN_PROBES) / slow + (TOTAL_PROBING - 1) * ((Z_CLEARANCE_MULTI_PROBE) / fast + (Z_CLEARANCE_MULTI_PROBE) / slow)
+    #else
+                  + (Z_CLEARANCE_BETWEEN_PROBES) / slow
+    #endif
+  ;
+
+  // Deploy, stow and acceleration are not counted, so this is a lower bound
+  const float seconds = mm / (XY_PROBE_FEEDRATE_MM_S) + count * per_point;
+  SERIAL_ECHOLNPAIR("Probe route: ", int(count), " points, ", int(mm), "mm travel, ~", int(seconds), "s");
+}
+
+#endif // PROBE_ROUTE
@@ -0,0 +1,61 @@
+/**
+ * Marlin 3D Printer Firmware
+ * Copyright (c) 2020 MarlinFirmware [https://github.com/MarlinFirmware/Marlin]
+ *
+ * Based on Sprinter and grbl.
+ * Copyright (c) 2011 Camiel Gubbels / Erik van der Zalm
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+#pragma once
+
+/**
+ * probe_route.h - Order the points of a mesh to be probed for less travel
+ *
+ * The route is built by going to the nearest point not yet visited, or
+ * kept in the order the points were added (a serpentine) if that's shorter,
+ * then improved by 2-opt moves that reverse a stretch of the route wherever
+ * that makes it shorter. Every point gets the same deploy, probe and
+ * Z raise, so only the XY travel between points depends on the order.
+ */
+
+#include "../../inc/MarlinConfig.h"
+
+class ProbeRoute {
+public:
+  xy_pos_t origin;                    // Probe position of mesh point [0][0]
+  xy_float_t spacing;                 // Distance between mesh points
+  uint8_t count;                      // Points in the route
+  xy_uint8_t point[GRID_MAX_POINTS];  // Mesh indexes, in probing order
+
+  ProbeRoute(const xy_pos_t &o, const xy_float_t &s) : origin(o), spacing(s), count(0) {}
+
+  void add(const uint8_t x, const uint8_t y) { point[count++].set(x, y); }
+
+  // Probe position of a route point
+  xy_pos_t pos(const uint8_t i) const { return origin + spacing * point[i].asFloat(); }
+
+  // Order the points to start from 'start'. Return the XY travel in mm.
+  float plan(const xy_pos_t &start);
+
+  // XY travel in mm to visit the points in their current order
+  float travel(const xy_pos_t &start) const;
+
+  // Print the point count, travel, and an estimate of the probing time
+  void report(const float mm) const;
+
+private:
+  void reverse(uint8_t i, uint8_t j);
+};
@@ -68,6 +68,16 @@
 
   float unified_bed_leveling::z_values[GRID_MAX_POINTS_X][GRID_MAX_POINTS_Y];
 
+  #if ENABLED(MESH_CELL_CACHE)
+    MeshCells<GRID_MAX_POINTS_X, GRID_MAX_POINTS_Y, false, true> unified_bed_leveling::cells;
+
+    void refresh_mesh_cells() {
+      ubl.cells.update({ MESH_MIN_X, MESH_MIN_Y }, { RECIPROCAL(MESH_X_DIST), RECIPROCAL(MESH_Y_DIST) },
+        [](const uint8_t x, const uint8_t y) { return ubl.z_values[x][y]; }
+      );
+    }
+  #endif
+
   #define _GRIDPOS(A,N) (MESH_MIN_##A + N * (MESH_##A##_DIST))
 
   const float
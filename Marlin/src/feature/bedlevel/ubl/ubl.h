@@ -25,6 +25,10 @@
 
 #include "../../../module/motion.h"
 
+#if ENABLED(MESH_CELL_CACHE)
+  #include "../mesh_cells.h"
+#endif
+
 #define DEBUG_OUT ENABLED(DEBUG_LEVELING_FEATURE)
 #include "../../../core/debug_out.h"
 
@@ -287,6 +291,23 @@ class unified_bed_leveling {
     }
     static inline float get_z_correction(const xy_pos_t &pos) { return get_z_correction(pos.x, pos.y); }
 
+    #if ENABLED(MESH_CELL_CACHE)
+      // Past the last mesh line hold the edge height, as above
+      static MeshCells<GRID_MAX_POINTS_X, GRID_MAX_POINTS_Y, false, true> cells;
+
+      /**
+       * get_z_correction from the cell table, for leveled moves.
+       * The table is only sure to match the mesh while leveling is on.
+       */
+      static inline float get_z_correction_fast(const xy_pos_t &pos) {
+        #ifdef UBL_Z_RAISE_WHEN_OFF_MESH
+          if (!WITHIN(pos.x, MESH_MIN_X, MESH_MAX_X) || !WITHIN(pos.y, MESH_MIN_Y, MESH_MAX_Y))
+            return UBL_Z_RAISE_WHEN_OFF_MESH;
+        #endif
+        return cells.get(pos);
+      }
+    #endif
+
     static inline float mesh_index_to_xpos(const uint8_t i) {
       return i < GRID_MAX_POINTS_X ? pgm_read_float(&_mesh_index_to_xpos[i]) : MESH_MIN_X + i * (MESH_X_DIST);
     }
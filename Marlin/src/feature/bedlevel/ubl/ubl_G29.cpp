@@ -49,6 +49,10 @@
     #include "../../../lcd/extui/ui_api.h"
   #endif
 
+  #if ENABLED(PROBE_ROUTE)
+    #include "../probe_route.h"
+  #endif
+
   #include <math.h>
 
   #define UBL_G29_P31
@@ -735,6 +739,20 @@
       save_ubl_active_state_and_disable();  // No bed level correction so only raw data is obtained
       uint8_t count = GRID_MAX_POINTS;
 
+      #if ENABLED(PROBE_ROUTE)
+        // Plan the whole route up front, unless probing the furthest points first
+        ProbeRoute route({ mesh_index_to_xpos(0), mesh_index_to_ypos(0) }, { MESH_X_DIST, MESH_Y_DIST });
+        if (!do_furthest) {
+          GRID_LOOP(x, i) {
+            const uint8_t y = x & 1 ? (GRID_MAX_POINTS_Y) - 1 - i : i;   // Serpentine
+            if (isnan(z_values[x][y]) && probe.can_reach(mesh_index_to_xpos(x), mesh_index_to_ypos(y)))
+              route.add(x, y);
+          }
+          route.report(route.plan(near));
+        }
+        uint8_t route_index = 0;
+      #endif
+
       mesh_index_pair best;
       do {
         if (do_ubl_mesh_map) display_map(g29_map_type);
@@ -755,9 +773,20 @@
           }
         #endif
 
-        best = do_furthest
-          ? find_furthest_invalid_mesh_point()
-          : find_closest_mesh_point_of_type(INVALID, near, true);
+        #if ENABLED(PROBE_ROUTE)
+          if (do_furthest)
+            best = find_furthest_invalid_mesh_point();
+          else if (route_index < route.count) {
+            const xy_uint8_t &p = route.point[route_index++];
+            best.pos.set(p.x, p.y);
+          }
+          else
+            best.invalidate();
+        #else
+          best = do_furthest
+            ? find_furthest_invalid_mesh_point()
+            : find_closest_mesh_point_of_type(INVALID, near, true);
+        #endif
 
         if (best.pos.x >= 0) {    // mesh point found and is reachable by probe
           TERN_(EXTENSIBLE_UI, ExtUI::onMeshUpdate(best.pos, ExtUI::PROBE_START));
@@ -342,7 +342,10 @@
     const float cart_xy_mm_2 = HYPOT2(total.x, total.y),
                 cart_xy_mm = SQRT(cart_xy_mm_2);                                     // Total XY distance
 
-    #if IS_KINEMATIC
+    #if IS_KINEMATIC && defined(KINEMATIC_SEGMENT_TOLERANCE)
+      const float seglimit = cart_xy_mm * RECIPROCAL(DELTA_SEGMENT_MIN_LENGTH);      // Number of segments at minimum segment length
+      uint16_t segments = CEIL(_MIN(kinematic_segments(current_position, destination), seglimit)); // Enough segments to keep the kinematic error in tolerance
+    #elif IS_KINEMATIC
       const float seconds = cart_xy_mm / scaled_fr_mm_s;                             // Duration of XY move at requested rate
       uint16_t segments = LROUND(delta_segments_per_second * seconds),               // Preferred number of segments for distance @ feedrate
                seglimit = LROUND(cart_xy_mm * RECIPROCAL(DELTA_SEGMENT_MIN_LENGTH)); // Number of segments at minimum segment length
@@ -390,6 +393,32 @@
       const float fade_scaling_factor = planner.fade_scaling_factor_for_z(destination.z);
     #endif
 
+    #if ENABLED(MESH_CELL_CACHE)
+
+      // Correct the segment ends a batch at a time from the cell table
+      float z_batch[16];
+      while (segments) {
+        const uint8_t n = _MIN(segments, COUNT(z_batch));
+        cells.get_line(raw, diff, n, z_batch);
+        LOOP_L_N(i, n) {
+          if (--segments) raw += diff; else raw = destination;  // Last segment goes to the exact destination
+          const float z_cxcy = z_batch[i]
+            #if ENABLED(ENABLE_LEVELING_FADE_HEIGHT)
+              * fade_scaling_factor                 // apply fade factor to interpolated mesh height
+            #endif
+          ;
+          planner.buffer_line(raw.x, raw.y, raw.z + z_cxcy, raw.e, scaled_fr_mm_s, active_extruder, segment_xyz_mm
+            #if ENABLED(SCARA_FEEDRATE_SCALING)
+              , inv_duration
+            #endif
+          );
+        }
+      }
+
+      return false; // caller will update current_position
+
+    #else
+
     // Move to first segment destination
     raw += diff;
 
@@ -476,6 +505,8 @@
     } // cell loop
 
     return false; // caller will update current_position
+
+    #endif // !MESH_CELL_CACHE
   }
 
 #endif // UBL_SEGMENTED
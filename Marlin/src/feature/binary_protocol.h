@@ -29,6 +29,11 @@
   #include "../libs/heatshrink/heatshrink_decoder.h"
 #endif
 
+#if ENABLED(BINARY_GCODE)
+  #include "../gcode/binary_gcode.h"
+  #include "../gcode/queue.h"
+#endif
+
 inline bool bs_serial_data_available(const uint8_t index) {
   switch (index) {
     case 0: return MYSERIAL0.available();
@@ -212,9 +217,75 @@ public:
   static const uint16_t VERSION_MAJOR = 0, VERSION_MINOR = 1, VERSION_PATCH = 0, TIMEOUT = 10000, IDLE_PERIOD = 1000;
 };
 
+#if ENABLED(BINARY_GCODE)
+
+/**
+ * G-code commands, to be run like lines from the host. A COMMANDS packet
+ * holds binary commands (See binary_gcode.h) and nul-terminated ASCII
+ * lines, one after another. Until the queue has room for all of them
+ * the packet is held with no "ok", so the host can keep streaming.
+ */
+class GCodeStreamProtocol {
+public:
+  enum class GCodeStream : uint8_t { QUERY, COMMANDS };
+
+  // The number of commands in a packet, or -1 if it's malformed
+  static int16_t count(const char * const buffer, const uint16_t length) {
+    int16_t n = 0;
+    for (uint16_t i = 0; i < length; n++) {
+      const uint8_t * const cmd = (uint8_t*)&buffer[i];
+      uint16_t size;
+      if (BinaryGCode::is_command(&buffer[i])) {
+        if (i + BinaryGCode::header_size(cmd[0]) > length) return -1;
+        size = BinaryGCode::size(cmd);
+      }
+      else
+        size = strnlen(&buffer[i], length - i) + 1;
+      if (size > MAX_CMD_SIZE || i + size > length) return -1;
+      i += size;
+    }
+    return n;
+  }
+
+  // Wait for room in the queue before taking a packet
+  static bool ready(const uint8_t packet_type, const char * const buffer, const uint16_t length) {
+    if (static_cast<GCodeStream>(packet_type) != GCodeStream::COMMANDS) return true;
+    const int16_t n = count(buffer, length);
+    return n < 0 || n > BUFSIZE || n <= BUFSIZE - queue.length;
+  }
+
+  static void process(const uint8_t packet_type, const char * const buffer, const uint16_t length) {
+    switch (static_cast<GCodeStream>(packet_type)) {
+      case GCodeStream::QUERY:
+        SERIAL_ECHOLNPAIR("PGC:version:", VERSION_MAJOR, ".", VERSION_MINOR, ".", VERSION_PATCH, ":fixed:", BGC_FIXED_SCALE);
+        break;
+      case GCodeStream::COMMANDS: {
+        const int16_t n = count(buffer, length);
+        if (n < 0 || n > BUFSIZE) { SERIAL_ECHOLNPGM("PGC:invalid"); break; }
+        for (uint16_t i = 0; i < length;) {
+          const uint8_t size = BinaryGCode::is_command(&buffer[i]) ? BinaryGCode::size((uint8_t*)&buffer[i]) : strlen(&buffer[i]) + 1;
+          if (size > 1) queue.enqueue_binary(&buffer[i], size
+            #if HAS_MULTI_SERIAL
+              , card.transfer_port_index
+            #endif
+          );
+          i += size;
+        }
+      } break;
+      default:
+        SERIAL_ECHOLNPGM("PGC:invalid");
+        break;
+    }
+  }
+
+  static const uint16_t VERSION_MAJOR = 0, VERSION_MINOR = 1, VERSION_PATCH = 0;
+};
+
+#endif // BINARY_GCODE
+
 class BinaryStream {
 public:
-  enum class Protocol : uint8_t { CONTROL, FILE_TRANSFER };
+  enum class Protocol : uint8_t { CONTROL, FILE_TRANSFER, GCODE };
 
   enum class ProtocolControl : uint8_t { SYNC = 1, CLOSE };
 
@@ -406,6 +477,11 @@ public:
           }
           break;
         case StreamState::PACKET_PROCESS:
+          #if ENABLED(BINARY_GCODE)
+            if (static_cast<Protocol>(packet.header.protocol()) == Protocol::GCODE
+              && !GCodeStreamProtocol::ready(packet.header.type(), packet.buffer, packet.header.size)
+            ) { idle(); return; }
+          #endif
           sync++;
           packet_retries = 0;
           bytes_received += packet.header.size;
@@ -454,6 +530,11 @@ public:
       case Protocol::FILE_TRANSFER:
         SDFileTransferProtocol::process(packet.header.type(), packet.buffer, packet.header.size); // send user data to be processed
       break;
+      #if ENABLED(BINARY_GCODE)
+        case Protocol::GCODE:
+          GCodeStreamProtocol::process(packet.header.type(), packet.buffer, packet.header.size);
+          break;
+      #endif
       default:
         SERIAL_ECHO_MSG("Unsupported Binary Protocol");
     }
@@ -0,0 +1,127 @@
+/**
+ * Marlin 3D Printer Firmware
+ * Copyright (c) 2020 MarlinFirmware [https://github.com/MarlinFirmware/Marlin]
+ *
+ * Based on Sprinter and grbl.
+ * Copyright (c) 2011 Camiel Gubbels / Erik van der Zalm
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+
+#include "../inc/MarlinConfig.h"
+
+#if ENABLED(INPUT_SHAPING)
+
+#include "input_shaping.h"
+#include "../module/planner.h"
+#include "../module/stepper.h"
+
+InputShaping input_shaping;
+
+AxisShaper InputShaping::axis[SHAPING_AXES];
+uint32_t InputShaping::now; // = 0
+bool InputShaping::suspended; // = false
+
+/**
+ * Work out the impulses for the axis settings, as in Singhose's
+ * "Command Generation for Flexible Systems". The shares are rounded
+ * to whole SHAPING_UNITs, with the rounding left on the last impulse.
+ */
+void AxisShaper::refresh(const bool suspend) {
+  head = 0;
+  ZERO(tail);
+  residual = 0;
+  impulses = 0;
+  enabled = !suspend && settings.frequency > 0;
+  if (!enabled) return;
+
+  const float zeta = settings.zeta,
+              df = SQRT(1.0f - sq(zeta)),             // Damped / natural frequency
+              period = 1.0f / (settings.frequency * df),
+              K = expf(-zeta * float(M_PI) / df);
+  float A[SHAPER_MAX_IMPULSES], T[SHAPER_MAX_IMPULSES];
+
+  switch (settings.type) {
+    default:
+    case SHAPER_ZV:
+      impulses = 2;
+      A[0] = 1; A[1] = K;
+      T[0] = 0; T[1] = 0.5f;
+      break;
+
+    case SHAPER_ZVD:
+      impulses = 3;
+      A[0] = 1; A[1] = 2 * K; A[2] = sq(K);
+      T[0] = 0; T[1] = 0.5f;  T[2] = 1;
+      break;
+
+    case SHAPER_MZV: {
+      const float k = expf(-0.75f * zeta * float(M_PI) / df);
+      impulses = 3;
+      A[0] = 1 - float(M_SQRT1_2); A[1] = (float(M_SQRT2) - 1) * k; A[2] = A[0] * sq(k);
+      T[0] = 0; T[1] = 0.375f; T[2] = 0.75f;
+    } break;
+
+    case SHAPER_EI: {
+      constexpr float v_tol = 0.05f;                  // Vibration left at the design frequency
+      impulses = 3;
+      A[0] = 0.25f * (1 + v_tol); A[1] = 0.5f * (1 - v_tol) * K; A[2] = A[0] * sq(K);
+      T[0] = 0; T[1] = 0.5f; T[2] = 1;
+    } break;
+  }
+
+  float sum = 0;
+  LOOP_L_N(i, impulses) sum += A[i];
+
+  uint16_t left = SHAPING_UNIT;
+  LOOP_L_N(i, impulses) {
+    amplitude[i] = (i == impulses - 1) ? left : uint16_t(LROUND(A[i] * (SHAPING_UNIT) / sum));
+    left -= amplitude[i];
+    delay[i] = T[i] * period * (STEPPER_TIMER_RATE);
+  }
+}
+
+void InputShaping::reset() {
+  constexpr float freq[] = { SHAPING_FREQ_X, SHAPING_FREQ_Y },
+                  zeta[] = { SHAPING_ZETA_X, SHAPING_ZETA_Y };
+  constexpr ShaperType type[] = { SHAPING_TYPE_X, SHAPING_TYPE_Y };
+  LOOP_L_N(a, SHAPING_AXES) {
+    axis[a].settings.frequency = freq[a];
+    axis[a].settings.zeta = zeta[a];
+    axis[a].settings.type = type[a];
+  }
+}
+
+/**
+ * Apply the settings once all moves and impulses are done.
+ * The DIR pins go back to the Stepper for axes no longer shaped.
+ */
+void InputShaping::refresh() {
+  planner.synchronize();
+
+  const bool was_awake = stepper.suspend();
+
+  LOOP_L_N(a, SHAPING_AXES) axis[a].enabled = false;
+  stepper.set_directions();
+
+  LOOP_L_N(a, SHAPING_AXES) {
+    axis[a].refresh(suspended);
+    axis[a].reversed = stepper.motor_direction(AxisEnum(a));
+  }
+
+  if (was_awake) stepper.wake_up();
+}
+
+#endif // INPUT_SHAPING
@@ -0,0 +1,137 @@
+/**
+ * Marlin 3D Printer Firmware
+ * Copyright (c) 2020 MarlinFirmware [https://github.com/MarlinFirmware/Marlin]
+ *
+ * Based on Sprinter and grbl.
+ * Copyright (c) 2011 Camiel Gubbels / Erik van der Zalm
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+#pragma once
+
+/**
+ * input_shaping.h - Input shaping for the X and Y steppers
+ *
+ * Each X/Y step taken by the Stepper ISR is split into two or three impulses
+ * that sum to one step. The first goes out with the step and the rest are
+ * sent later by the Stepper ISR, timed to cancel the ringing of the axis at
+ * its resonant frequency. Steps waiting for their later impulses are queued
+ * with their timer tick and direction.
+ */
+
+#include "../inc/MarlinConfig.h"
+
+enum ShaperType : uint8_t { SHAPER_ZV, SHAPER_ZVD, SHAPER_MZV, SHAPER_EI, SHAPER_COUNT };
+
+#define SHAPING_AXES          2         // X and Y
+#define SHAPER_MAX_IMPULSES   3
+#define SHAPING_UNIT       1024         // One step, as shared between the impulses
+#define SHAPING_STEP_LEVEL  640         // Residual that makes a step. Over half a step, to avoid dithering.
+#define SHAPING_NEVER 0xFFFFFFFF
+
+typedef struct {
+  float frequency;                      // (Hz) Ringing frequency. 0 = off.
+  float zeta;                           // Damping ratio
+  ShaperType type;
+} shaper_settings_t;
+
+class AxisShaper {
+public:
+  shaper_settings_t settings;
+
+  bool enabled;                         // Shaping this axis. The shaper owns its DIR pin.
+  bool reversed;                        // Direction set on the DIR pin
+  uint8_t impulses;
+  uint16_t amplitude[SHAPER_MAX_IMPULSES]; // Share of the step, out of SHAPING_UNIT
+  uint32_t delay[SHAPER_MAX_IMPULSES];  // Stepper timer ticks after the step
+  int32_t residual;                     // Impulses received minus steps sent, in SHAPING_UNITs
+  uint16_t head, tail[SHAPER_MAX_IMPULSES];
+  uint32_t echo[SHAPING_BUFFER_SIZE];   // Tick of each step. Bit 0 set for reverse.
+
+  void refresh(const bool suspend);
+
+  FORCE_INLINE bool has_room(const uint8_t n) const {
+    return uint16_t(head - tail[impulses - 1]) + n <= SHAPING_BUFFER_SIZE;
+  }
+
+  // A step from the planner. Its first impulse is added now.
+  FORCE_INLINE void input(const uint32_t now, const bool reverse) {
+    echo[head++ & (SHAPING_BUFFER_SIZE - 1)] = (now & ~1UL) | reverse;
+    residual += reverse ? -amplitude[0] : amplitude[0];
+  }
+
+  // Add the later impulses that are due
+  FORCE_INLINE void echoes(const uint32_t now) {
+    for (uint8_t i = 1; i < impulses; i++)
+      for (; tail[i] != head; tail[i]++) {
+        const uint32_t e = echo[tail[i] & (SHAPING_BUFFER_SIZE - 1)];
+        if (now - (e & ~1UL) < delay[i]) break;
+        residual += (e & 1) ? -amplitude[i] : amplitude[i];
+      }
+  }
+
+  // Ticks until the next impulse is due
+  FORCE_INLINE uint32_t next(const uint32_t now) const {
+    uint32_t n = SHAPING_NEVER;
+    for (uint8_t i = 1; i < impulses; i++)
+      if (tail[i] != head) NOMORE(n, (echo[tail[i] & (SHAPING_BUFFER_SIZE - 1)] & ~1UL) + delay[i] - now);
+    return n;
+  }
+
+  // The step to send to the pins: 1, -1, or 0 for none
+  FORCE_INLINE int8_t step_due() const {
+    return residual >= SHAPING_STEP_LEVEL ? 1 : residual <= -(SHAPING_STEP_LEVEL) ? -1 : 0;
+  }
+
+  FORCE_INLINE bool idle() const { return !enabled || (tail[impulses - 1] == head && !step_due()); }
+};
+
+class InputShaping {
+public:
+  static AxisShaper axis[SHAPING_AXES];
+  static uint32_t now;                  // Stepper timer ticks, counted by the Stepper ISR
+  static bool suspended;
+
+  static void reset();
+  static void refresh();
+
+  // Homing needs the steps to reach the pins as soon as they're taken
+  static inline void suspend(const bool s) { suspended = s; refresh(); }
+
+  static inline bool idle() {
+    LOOP_L_N(a, SHAPING_AXES) if (!axis[a].idle()) return false;
+    return true;
+  }
+
+  //
+  // Called by the Stepper ISR
+  //
+  static FORCE_INLINE bool has_room(const uint8_t n) {
+    LOOP_L_N(a, SHAPING_AXES) if (axis[a].enabled && !axis[a].has_room(n)) return false;
+    return true;
+  }
+
+  static FORCE_INLINE void echoes() {
+    LOOP_L_N(a, SHAPING_AXES) if (axis[a].enabled) axis[a].echoes(now);
+  }
+
+  static FORCE_INLINE uint32_t next() {
+    uint32_t n = SHAPING_NEVER;
+    LOOP_L_N(a, SHAPING_AXES) if (axis[a].enabled) NOMORE(n, axis[a].next(now));
+    return n;
+  }
+};
+
+extern InputShaping input_shaping;
@@ -0,0 +1,235 @@
+/**
+ * Marlin 3D Printer Firmware
+ * Copyright (c) 2020 MarlinFirmware [https://github.com/MarlinFirmware/Marlin]
+ *
+ * Based on Sprinter and grbl.
+ * Copyright (c) 2011 Camiel Gubbels / Erik van der Zalm
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+
+/**
+ * object_index.cpp - Byte ranges of the M486 objects in the SD file being printed
+ */
+
+#include "../inc/MarlinConfig.h"
+
+#if ENABLED(CANCEL_OBJECTS_INDEX)
+
+#include "object_index.h"
+#include "cancel_object.h"
+#include "../sd/cardreader.h"
+#include "../gcode/parser.h"
+
+ObjectIndex object_index;
+
+ObjectIndex::range_t ObjectIndex::ranges[CANCEL_OBJECTS_INDEX_SIZE], ObjectIndex::range;
+uint8_t ObjectIndex::head, ObjectIndex::count;
+bool ObjectIndex::in_range, ObjectIndex::relative_e;
+
+bool ObjectIndex::pending_e, ObjectIndex::pending_f;
+float ObjectIndex::pending_e_val, ObjectIndex::pending_f_val;
+
+SdFile ObjectIndex::file;
+bool ObjectIndex::scanning;
+uint32_t ObjectIndex::block_pos, ObjectIndex::line_start;
+uint8_t ObjectIndex::block[512];
+uint16_t ObjectIndex::block_len, ObjectIndex::block_ind;
+char ObjectIndex::line[MAX_CMD_SIZE];
+uint8_t ObjectIndex::line_len;
+bool ObjectIndex::discard, ObjectIndex::comment, ObjectIndex::unsafe;
+
+/**
+ * Start over for a newly opened file
+ */
+void ObjectIndex::reset() {
+  relative_e = false;
+  pending_e = pending_f = false;
+  scanning = !TERN0(SD_COMPRESSED_GCODE, card.flag.compressed);
+  file = card.getfile();
+  resync(0);
+}
+
+/**
+ * Scan from the start of the line after 'pos', dropping the ranges before it
+ */
+void ObjectIndex::resync(const uint32_t pos) {
+  head = count = 0;                             // Any ranges are behind 'pos'
+  in_range = false;
+  block_pos = pos & ~uint32_t(sizeof(block) - 1); // Read whole blocks to bypass the volume cache
+  block_len = block_ind = 0;
+  line_start = pos;
+  line_len = 0;
+  discard = pos > 0;
+  comment = unsafe = false;
+  if (!file.seekSet(block_pos)) scanning = false;
+}
+
+/**
+ * Scan the next block of the file, or what's left of it, unless the index is full
+ */
+void ObjectIndex::scan() {
+  if (!scanning) return;
+
+  // Catch up if the reader got ahead
+  const uint32_t reader_pos = card.getIndex();
+  if (block_pos + block_ind < reader_pos) resync(reader_pos);
+
+  if (block_ind >= block_len) {
+    block_pos += block_len;
+    const int16_t n = file.read(block, sizeof(block));
+    if (n <= 0) {                               // End of the file
+      if (line_len) end_line(block_pos);
+      if (in_range && count < CANCEL_OBJECTS_INDEX_SIZE) {
+        range.end = block_pos;
+        push();
+      }
+      scanning = false;
+      return;
+    }
+    block_len = n;
+    block_ind = 0;
+  }
+
+  // A line adds at most one range, so stop with one place left
+  for (; block_ind < block_len && count < CANCEL_OBJECTS_INDEX_SIZE; block_ind++) {
+    const char c = block[block_ind];
+    if (c == '\n' || c == '\r') { end_line(block_pos + block_ind); continue; }
+    if (TEST(c, 7)) unsafe = true;              // Binary G-code
+    if (discard || comment) continue;
+    if (c == ';') { comment = true; continue; }
+    if (line_len < sizeof(line) - 1) line[line_len++] = c; else unsafe = true;
+  }
+}
+
+void ObjectIndex::end_line(const uint32_t eol) {
+  if (!discard) {
+    line[line_len] = '\0';
+    process_line(line, line_start, eol);
+  }
+  line_start = eol + 1;
+  line_len = 0;
+  discard = comment = unsafe = false;
+}
+
+/**
+ * Follow one line of the file. 'start' is its first character and 'eol' the character ending it.
+ */
+void ObjectIndex::process_line(char *l, const uint32_t start, const uint32_t eol) {
+  while (*l == ' ') l++;
+
+  const bool is_g = (*l == 'G'), is_m = (*l == 'M');
+  if (!is_g && !is_m) {
+    if (in_range && (*l || unsafe)) range.skippable = false;
+    return;
+  }
+  const int32_t code = GCodeParser::parse_long(l + 1);
+
+  // M486 S<n> ends a range and starts the next. S-1 is outside of all objects.
+  if (is_m && code == 486) {
+    const char * const s = strchr(l, 'S');
+    if (!s) {
+      if (in_range) range.skippable = false;
+      return;
+    }
+    if (in_range) {
+      range.end = start;
+      push();
+    }
+    const int32_t obj = GCodeParser::parse_long(s + 1);
+    in_range = WITHIN(obj, 0, 31);
+    if (in_range) {
+      range.start = eol;
+      range.obj = obj;
+      range.skippable = true;
+      range.has_e = range.has_f = false;
+    }
+    return;
+  }
+
+  // The E mode is followed through the whole file
+  const bool e_mode = is_m ? (code == 82 || code == 83) : (code == 90 || code == 91);
+  if (e_mode) relative_e = (code == 83 || code == 91);
+
+  if (!in_range) return;
+
+  if (e_mode || unsafe)
+    range.skippable = false;
+  else if (is_g && (code <= 3 || code == 92)) {
+    const char * const e = strchr(l, 'E');
+    if (code == 92 && (!e || strpbrk(l, "XYZ")))
+      range.skippable = false;                  // Only G92 E can be left out
+    else {
+      if (e && !relative_e) {
+        range.e = GCodeParser::parse_float(e + 1);
+        range.has_e = true;
+      }
+      const char * const f = strchr(l, 'F');
+      if (f) {
+        range.f = GCodeParser::parse_float(f + 1);
+        range.has_f = true;
+      }
+    }
+  }
+  else if (!is_m || (code != 73 && code != 117)) // Progress and messages can be left out
+    range.skippable = false;
+}
+
+/**
+ * Called by the SD reader with each line, before it's queued.
+ * After M486 S<n> for a canceled object seek past its range.
+ */
+void ObjectIndex::line_read(const char * const cmd) {
+  const char *l = cmd;
+  while (*l == ' ') l++;
+  if (l[0] != 'M' || l[1] != '4' || l[2] != '8' || l[3] != '6') return;
+  const char * const s = strchr(l, 'S');
+  if (!s) return;
+
+  // Drop ranges the reader has passed
+  const uint32_t pos = card.getIndex();
+  while (count && ranges[head].start < pos) pop();
+  if (!count || ranges[head].start != pos) return;
+
+  const range_t &r = ranges[head];
+  if (r.obj == GCodeParser::parse_long(s + 1) && r.skippable && cancelable.is_canceled(r.obj)) {
+    card.setIndex(r.end);
+    pending_e = r.has_e;
+    pending_e_val = r.e;
+    pending_f = r.has_f;
+    pending_f_val = r.f;
+  }
+  pop();
+}
+
+/**
+ * Get a command to restore what a skipped range would have set
+ */
+bool ObjectIndex::next_command(char * const cmd) {
+  char str[20];
+  if (pending_e) {
+    pending_e = false;
+    sprintf_P(cmd, PSTR("G92 E%s"), dtostrf(pending_e_val, 1, 5, str));
+    return true;
+  }
+  if (pending_f) {
+    pending_f = false;
+    sprintf_P(cmd, PSTR("G1 F%s"), dtostrf(pending_f_val, 1, 3, str));
+    return true;
+  }
+  return false;
+}
+
+#endif // CANCEL_OBJECTS_INDEX
@@ -0,0 +1,85 @@
+/**
+ * Marlin 3D Printer Firmware
+ * Copyright (c) 2020 MarlinFirmware [https://github.com/MarlinFirmware/Marlin]
+ *
+ * Based on Sprinter and grbl.
+ * Copyright (c) 2011 Camiel Gubbels / Erik van der Zalm
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+#pragma once
+
+/**
+ * object_index.h - Byte ranges of the M486 objects in the SD file being printed
+ *
+ * The file is scanned a block at a time, ahead of the reader, for each
+ * "M486 S<n>" up to the next "M486 S". When the reader reaches a range
+ * whose object is canceled it seeks to the end of the range, so none of
+ * those lines are read, parsed, or run.
+ *
+ * A range is only skipped if its lines can't change what comes after:
+ * G0-G3 and G92 E moves, plus M73 and M117. The last E (in absolute mode)
+ * and F of the range are set afterwards with G92 E and G1 F. Any other
+ * command leaves the range to be skipped move by move, as before.
+ */
+
+#include "../inc/MarlinConfigPre.h"
+#include "../sd/SdFile.h"
+
+class ObjectIndex {
+public:
+  static void reset();
+  static void scan();
+  static void line_read(const char * const cmd);
+  static bool next_command(char * const cmd);
+
+private:
+  typedef struct {
+    uint32_t start,   // The end of the M486 S<n> line
+             end;     // The start of the next M486 S line
+    float e, f;       // The last E (absolute) and F in the range
+    int8_t obj;
+    bool skippable:1, has_e:1, has_f:1;
+  } range_t;
+
+  static range_t ranges[CANCEL_OBJECTS_INDEX_SIZE], range;
+  static uint8_t head, count;
+  static bool in_range, relative_e;
+
+  // Commands to run after a skipped range
+  static bool pending_e, pending_f;
+  static float pending_e_val, pending_f_val;
+
+  // The scan, a block at a time
+  static SdFile file;
+  static bool scanning;
+  static uint32_t block_pos, line_start;
+  static uint8_t block[512];
+  static uint16_t block_len, block_ind;
+  static char line[MAX_CMD_SIZE];
+  static uint8_t line_len;
+  static bool discard, comment, unsafe;
+
+  static void resync(const uint32_t pos);
+  static void end_line(const uint32_t eol);
+  static void process_line(char *l, const uint32_t start, const uint32_t eol);
+  static inline void push() {
+    ranges[(head + count) % (CANCEL_OBJECTS_INDEX_SIZE)] = range;
+    count++;
+  }
+  static inline void pop() { head = (head + 1) % (CANCEL_OBJECTS_INDEX_SIZE); count--; }
+};
+
+extern ObjectIndex object_index;
@@ -44,6 +44,13 @@ uint32_t PrintJobRecovery::cmd_sdpos, // = 0
   bool PrintJobRecovery::dwin_flag; // = false
 #endif
 
+#if ENABLED(POWER_LOSS_JOURNAL)
+  PrintJobRecovery::JournalPending PrintJobRecovery::journal_pending; // = JOURNAL_NONE
+  uint16_t PrintJobRecovery::journal_serial; // = 0
+  uint8_t PrintJobRecovery::journal_slot,    // = 0
+          PrintJobRecovery::journal_records; // = 0
+#endif
+
 #include "../sd/cardreader.h"
 #include "../lcd/ultralcd.h"
 #include "../gcode/queue.h"
@@ -58,6 +65,10 @@ uint32_t PrintJobRecovery::cmd_sdpos, // = 0
   #include "fwretract.h"
 #endif
 
+#if ENABLED(POWER_LOSS_JOURNAL)
+  #include "../libs/crc16.h"
+#endif
+
 #define DEBUG_OUT ENABLED(DEBUG_POWER_LOSS_RECOVERY)
 #include "../core/debug_out.h"
 
@@ -77,10 +88,24 @@ PrintJobRecovery recovery;
   #define POWER_LOSS_RETRACT_LEN 0
 #endif
 
+#if ENABLED(POWER_LOSS_JOURNAL)
+  // Offset of a slot in the recovery file, and of the journal in a slot
+  constexpr uint32_t journal_start = sizeof(uint16_t) + sizeof(job_recovery_info_t),
+                     slot_size = journal_start + (POWER_LOSS_JOURNAL_RECORDS) * sizeof(job_journal_record_t);
+  inline uint32_t slot_offset(const uint8_t slot) { return slot * slot_size; }
+#endif
+
 /**
  * Clear the recovery info
  */
-void PrintJobRecovery::init() { memset(&info, 0, sizeof(info)); }
+void PrintJobRecovery::init() {
+  memset(&info, 0, sizeof(info));
+  #if ENABLED(POWER_LOSS_JOURNAL)
+    journal_pending = JOURNAL_NONE;
+    journal_serial = journal_slot = 0;
+    journal_records = POWER_LOSS_JOURNAL_RECORDS; // Start with a full save
+  #endif
+}
 
 /**
  * Enable or disable then call changed()
@@ -131,7 +156,11 @@ void PrintJobRecovery::purge() {
 void PrintJobRecovery::load() {
   if (exists()) {
     open(true);
-    (void)file.read(&info, sizeof(info));
+    #if ENABLED(POWER_LOSS_JOURNAL)
+      load_journal();
+    #else
+      (void)file.read(&info, sizeof(info));
+    #endif
     close();
   }
   
@@ -144,6 +173,7 @@ void PrintJobRecovery::load() {
 void PrintJobRecovery::prepare() {
   card.getAbsFilename(info.sd_filename);  // SD filename
   cmd_sdpos = 0;
+  TERN_(POWER_LOSS_JOURNAL, journal_records = POWER_LOSS_JOURNAL_RECORDS); // A new job starts with a full save
 }
 
 /**
@@ -227,7 +257,15 @@ void PrintJobRecovery::save(const bool force/*=false*/, const float zraise/*=0*/
     // Elapsed print job time
     info.print_job_elapsed = print_job_timer.duration();
 
-    write();
+    #if ENABLED(POWER_LOSS_JOURNAL)
+      // Leave the SD write for idle(). Later saves replace this one until then.
+      if (force || journal_records >= POWER_LOSS_JOURNAL_RECORDS)
+        journal_pending = JOURNAL_FULL;
+      else if (!journal_pending)
+        journal_pending = JOURNAL_RECORD;
+    #else
+      write();
+    #endif
   }
 }
 
@@ -286,7 +324,10 @@ void PrintJobRecovery::save(const bool force/*=false*/, const float zraise/*=0*/
     #endif
 
     // Save, including the limited Z raise
-    if (IS_SD_PRINTING()) save(true, zraise);
+    if (IS_SD_PRINTING()) {
+      save(true, zraise);
+      TERN_(POWER_LOSS_JOURNAL, flush()); // No waiting for idle()
+    }
 
     // Disable all heaters to reduce power loss
     thermalManager.disable_all_heaters();
@@ -311,12 +352,145 @@ void PrintJobRecovery::write() {
   debug(PSTR("Write"));
 
   open(false);
-  file.seekSet(0);
-  const int16_t ret = file.write(&info, sizeof(info));
-  if (ret == -1) DEBUG_ECHOLNPGM("Power-loss file write failed.");
+
+  #if ENABLED(POWER_LOSS_JOURNAL)
+
+    // Use the other slot, so the last full save stays good until this is done
+    journal_slot ^= 1;
+    if (!++journal_serial) ++journal_serial;  // non-zero in sequence
+    journal_records = 0;
+
+    // A new file must first be filled out to the start of the slot
+    const uint32_t pos = slot_offset(journal_slot);
+    const uint8_t zero[sizeof(job_journal_record_t)] = { 0 };
+    bool ok = file.seekEnd();
+    while (ok && file.fileSize() < pos)
+      ok = file.write(zero, _MIN(sizeof(zero), pos - file.fileSize())) != -1;
+
+    // The full save, then a blank record to end the journal
+    ok = ok && file.seekSet(pos)
+            && file.write(&journal_serial, sizeof(journal_serial)) != -1
+            && file.write(&info, sizeof(info)) != -1
+            && file.write(zero, sizeof(zero)) != -1;
+    if (!ok) DEBUG_ECHOLNPGM("Power-loss file write failed.");
+
+  #else
+
+    file.seekSet(0);
+    const int16_t ret = file.write(&info, sizeof(info));
+    if (ret == -1) DEBUG_ECHOLNPGM("Power-loss file write failed.");
+
+  #endif
+
   if (!file.close()) DEBUG_ECHOLNPGM("Power-loss file close failed.");
 }
 
+#if ENABLED(POWER_LOSS_JOURNAL)
+
+  /**
+   * Write the last save to the recovery file
+   */
+  void PrintJobRecovery::flush() {
+    if (!card.isMounted()) return;
+    const bool full = journal_pending == JOURNAL_FULL;
+    journal_pending = JOURNAL_NONE;
+    if (full) write(); else write_record();
+  }
+
+  /**
+   * Append a record of the changing state to the journal
+   */
+  void PrintJobRecovery::write_record() {
+    job_journal_record_t rec;
+    memset(&rec, 0, sizeof(rec));
+
+    rec.serial = journal_serial;
+    rec.sdpos = info.sdpos;
+    rec.current_position = info.current_position;
+    rec.feedrate = info.feedrate;
+    #if EXTRUDERS > 1
+      rec.active_extruder = info.active_extruder;
+    #endif
+    #if HAS_HOTEND
+      COPY(rec.target_temperature, info.target_temperature);
+    #endif
+    TERN_(HAS_HEATED_BED, rec.target_temperature_bed = info.target_temperature_bed);
+    #if HAS_FAN
+      COPY(rec.fan_speed, info.fan_speed);
+    #endif
+    #if ENABLED(FWRETRACT)
+      COPY(rec.retract, info.retract);
+      rec.retract_hop = info.retract_hop;
+    #endif
+    rec.print_job_elapsed = info.print_job_elapsed;
+    crc16(&rec.crc, &rec, offsetof(job_journal_record_t, crc));
+
+    debug(PSTR("Record"));
+
+    open(false);
+    const bool ok = file.seekSet(slot_offset(journal_slot) + journal_start + journal_records * sizeof(rec))
+                 && file.write(&rec, sizeof(rec)) != -1;
+    if (!ok) DEBUG_ECHOLNPGM("Power-loss file write failed.");
+    if (!file.close()) DEBUG_ECHOLNPGM("Power-loss file close failed.");
+    journal_records++;
+  }
+
+  /**
+   * Load the newest good full save and the records after it
+   */
+  void PrintJobRecovery::load_journal() {
+    // Find the newest slot with a good full save
+    int8_t newest = -1;
+    LOOP_L_N(s, 2) {
+      uint16_t serial;
+      if (file.seekSet(slot_offset(s))
+        && file.read(&serial, sizeof(serial)) == sizeof(serial)
+        && file.read(&info, sizeof(info)) == sizeof(info)
+        && serial && info.valid()
+        && (newest < 0 || int16_t(serial - journal_serial) > 0)
+      ) {
+        newest = s;
+        journal_serial = serial;
+      }
+    }
+
+    if (newest < 0) return init();
+
+    file.seekSet(slot_offset(newest) + sizeof(journal_serial));
+    file.read(&info, sizeof(info));
+    journal_slot = newest;
+
+    // Apply each record in turn, up to the first bad one
+    job_journal_record_t rec;
+    for (journal_records = 0; journal_records < POWER_LOSS_JOURNAL_RECORDS; journal_records++) {
+      if (file.read(&rec, sizeof(rec)) != sizeof(rec) || rec.serial != journal_serial) break;
+      uint16_t crc = 0;
+      crc16(&crc, &rec, offsetof(job_journal_record_t, crc));
+      if (crc != rec.crc) break;
+
+      info.sdpos = rec.sdpos;
+      info.current_position = rec.current_position;
+      info.feedrate = rec.feedrate;
+      #if EXTRUDERS > 1
+        info.active_extruder = rec.active_extruder;
+      #endif
+      #if HAS_HOTEND
+        COPY(info.target_temperature, rec.target_temperature);
+      #endif
+      TERN_(HAS_HEATED_BED, info.target_temperature_bed = rec.target_temperature_bed);
+      #if HAS_FAN
+        COPY(info.fan_speed, rec.fan_speed);
+      #endif
+      #if ENABLED(FWRETRACT)
+        COPY(info.retract, rec.retract);
+        info.retract_hop = rec.retract_hop;
+      #endif
+      info.print_job_elapsed = rec.print_job_elapsed;
+    }
+  }
+
+#endif // POWER_LOSS_JOURNAL
+
 /**
  * Resume the saved print job
  */
@@ -113,6 +113,47 @@ typedef struct {
 
 } job_recovery_info_t;
 
+#if ENABLED(POWER_LOSS_JOURNAL)
+
+  /**
+   * The recovery file has two slots. Each holds a full save followed by
+   * a journal of records with only the state that changes as a print goes
+   * on. Full saves alternate between the slots, so the last one remains
+   * intact while the next is being written.
+   */
+  typedef struct {
+    uint16_t serial;                  // Serial number of the full save this follows
+    uint32_t sdpos;
+    xyze_pos_t current_position;
+    uint16_t feedrate;
+
+    #if EXTRUDERS > 1
+      uint8_t active_extruder;
+    #endif
+
+    #if HAS_HOTEND
+      int16_t target_temperature[HOTENDS];
+    #endif
+
+    #if HAS_HEATED_BED
+      int16_t target_temperature_bed;
+    #endif
+
+    #if HAS_FAN
+      uint8_t fan_speed[FAN_COUNT];
+    #endif
+
+    #if ENABLED(FWRETRACT)
+      float retract[EXTRUDERS], retract_hop;
+    #endif
+
+    millis_t print_job_elapsed;
+
+    uint16_t crc;                     // CRC16 of everything above
+  } job_journal_record_t;
+
+#endif
+
 class PrintJobRecovery {
   public:
     static const char filename[5];
@@ -167,6 +208,12 @@ class PrintJobRecovery {
     static void load();
     static void save(const bool force=ENABLED(SAVE_EACH_CMD_MODE), const float zraise=0);
 
+    #if ENABLED(POWER_LOSS_JOURNAL)
+      // Write the last save, if any, to the recovery file. Called from idle().
+      static inline void idle() { if (journal_pending) flush(); }
+      static void flush();
+    #endif
+
     #if PIN_EXISTS(POWER_LOSS)
       static inline void outage() {
         if (enabled && READ(POWER_LOSS_PIN) == POWER_LOSS_STATE)
@@ -185,6 +232,16 @@ class PrintJobRecovery {
   private:
     static void write();
 
+    #if ENABLED(POWER_LOSS_JOURNAL)
+      enum JournalPending : uint8_t { JOURNAL_NONE, JOURNAL_RECORD, JOURNAL_FULL };
+      static JournalPending journal_pending;  //!< What the next flush() will write
+      static uint16_t journal_serial;         //!< Serial number of the last full save
+      static uint8_t journal_slot,            //!< Slot holding the last full save
+                     journal_records;         //!< Records written after it
+      static void write_record();
+      static void load_journal();
+    #endif
+
     #if ENABLED(BACKUP_POWER_SUPPLY)
       static void retract_and_lift(const float &zraise);
     #endif
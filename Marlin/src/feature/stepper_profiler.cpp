@@ -0,0 +1,98 @@
+/**
+ * Marlin 3D Printer Firmware
+ * Copyright (c) 2020 MarlinFirmware [https://github.com/MarlinFirmware/Marlin]
+ *
+ * Based on Sprinter and grbl.
+ * Copyright (c) 2011 Camiel Gubbels / Erik van der Zalm
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+
+#include "../inc/MarlinConfigPre.h"
+
+#if ENABLED(STEPPER_ISR_PROFILER)
+
+#include "stepper_profiler.h"
+
+StepperProfiler stepper_profiler;
+
+StepperProfiler::phase_stats_t StepperProfiler::phase_stats[PHASE_COUNT];
+uint32_t StepperProfiler::isr_calls, StepperProfiler::late_count, StepperProfiler::loops_exhausted;
+uint32_t StepperProfiler::isr_histogram[histogram_size], StepperProfiler::late_histogram[histogram_size];
+hal_timer_t StepperProfiler::isr_max_ticks, StepperProfiler::min_slack_ticks = HAL_TIMER_TYPE_MAX;
+
+void StepperProfiler::reset() {
+  const bool was_enabled = STEPPER_ISR_ENABLED();
+  if (was_enabled) DISABLE_STEPPER_DRIVER_INTERRUPT();
+  ZERO(phase_stats);
+  ZERO(isr_histogram);
+  ZERO(late_histogram);
+  isr_calls = late_count = loops_exhausted = 0;
+  isr_max_ticks = 0;
+  min_slack_ticks = HAL_TIMER_TYPE_MAX;
+  if (was_enabled) ENABLE_STEPPER_DRIVER_INTERRUPT();
+}
+
+static inline float ticks_to_us(const float ticks) { return ticks / (STEPPER_TIMER_TICKS_PER_US); }
+
+static void report_histogram(PGM_P const label, const uint32_t (&histogram)[StepperProfiler::histogram_size]) {
+  serialprintPGM(label);
+  LOOP_L_N(b, StepperProfiler::histogram_size) {
+    if (!histogram[b]) continue;
+    SERIAL_ECHOPAIR_F(" <", ticks_to_us(hal_timer_t(1) << b), 2);
+    SERIAL_ECHOPAIR(":", histogram[b]);
+  }
+  SERIAL_EOL();
+}
+
+static void report_phase(PGM_P const name, const StepperProfiler::phase_stats_t &s) {
+  if (!s.calls) return;
+  SERIAL_CHAR(' ');
+  serialprintPGM(name);
+  SERIAL_ECHOPAIR(" calls:", s.calls);
+  SERIAL_ECHOPAIR_F(" avg(us):", ticks_to_us(float(s.ticks) / s.calls), 2);
+  SERIAL_ECHOLNPAIR_F(" max(us):", ticks_to_us(s.max_ticks), 2);
+}
+
+void StepperProfiler::report() {
+  // Take a consistent copy so the ISR can't change the numbers mid-report
+  const bool was_enabled = STEPPER_ISR_ENABLED();
+  if (was_enabled) DISABLE_STEPPER_DRIVER_INTERRUPT();
+  const phase_stats_t ps[PHASE_COUNT] = { phase_stats[PULSE], phase_stats[ADVANCE], phase_stats[BABYSTEP], phase_stats[SHAPING], phase_stats[BLOCK] };
+  uint32_t ih[histogram_size], lh[histogram_size];
+  COPY(ih, isr_histogram);
+  COPY(lh, late_histogram);
+  const uint32_t calls = isr_calls, late = late_count, exhausted = loops_exhausted;
+  const hal_timer_t max_ticks = isr_max_ticks, slack = min_slack_ticks;
+  if (was_enabled) ENABLE_STEPPER_DRIVER_INTERRUPT();
+
+  SERIAL_ECHOLNPAIR("Stepper ISR calls:", calls);
+  if (calls) SERIAL_ECHOLNPAIR_F(" Max (us):", ticks_to_us(max_ticks), 2);
+
+  report_phase(PSTR("pulse"), ps[PULSE]);
+  report_phase(PSTR("advance"), ps[ADVANCE]);
+  report_phase(PSTR("babystep"), ps[BABYSTEP]);
+  report_phase(PSTR("shaping"), ps[SHAPING]);
+  report_phase(PSTR("block"), ps[BLOCK]);
+
+  report_histogram(PSTR(" ISR time (us)"), ih);
+
+  SERIAL_ECHOPAIR(" Late:", late);
+  if (slack != HAL_TIMER_TYPE_MAX) SERIAL_ECHOPAIR_F(" Min slack (us):", ticks_to_us(slack), 2);
+  SERIAL_ECHOLNPAIR(" Loop limit hit:", exhausted);
+  if (late) report_histogram(PSTR(" Late by (us)"), lh);
+}
+
+#endif // STEPPER_ISR_PROFILER
@@ -0,0 +1,94 @@
+/**
+ * Marlin 3D Printer Firmware
+ * Copyright (c) 2020 MarlinFirmware [https://github.com/MarlinFirmware/Marlin]
+ *
+ * Based on Sprinter and grbl.
+ * Copyright (c) 2011 Camiel Gubbels / Erik van der Zalm
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+#pragma once
+
+/**
+ * stepper_profiler.h - Stepper ISR cycle-budget profiler
+ *
+ * Times each phase of Stepper::isr() with the stepper timer count and keeps
+ * log2 histograms of the whole ISR duration and of how late 'next_isr_ticks'
+ * fell behind 'min_ticks'. Everything is kept in timer ticks so the ISR only
+ * pays for a few adds; conversion to µs happens when M123 reports.
+ */
+
+#include "../inc/MarlinConfig.h"
+
+class StepperProfiler {
+public:
+  enum Phase : uint8_t { PULSE, ADVANCE, BABYSTEP, SHAPING, BLOCK, PHASE_COUNT };
+
+  static constexpr uint8_t histogram_size = 16;   // Bucket n holds durations under 2^n ticks
+
+  struct phase_stats_t { uint32_t calls; uint64_t ticks; hal_timer_t max_ticks; };
+
+  static phase_stats_t phase_stats[PHASE_COUNT];
+  static uint32_t isr_calls, late_count, loops_exhausted;
+  static uint32_t isr_histogram[histogram_size], late_histogram[histogram_size];
+  static hal_timer_t isr_max_ticks, min_slack_ticks;
+
+  static FORCE_INLINE hal_timer_t now() { return HAL_timer_get_count(STEP_TIMER_NUM); }
+
+  static FORCE_INLINE uint8_t bucket(const hal_timer_t ticks) {
+    uint8_t b = 0;
+    for (hal_timer_t t = ticks; t && b < histogram_size - 1; t >>= 1) b++;
+    return b;
+  }
+
+  static FORCE_INLINE void phase(const Phase p, const hal_timer_t start) {
+    const hal_timer_t ticks = now() - start;
+    phase_stats_t &s = phase_stats[p];
+    s.calls++;
+    s.ticks += ticks;
+    NOLESS(s.max_ticks, ticks);
+  }
+
+  // The loop compared 'next_isr_ticks' to 'min_ticks'. Record the slack, or how late it was.
+  static FORCE_INLINE void deadline(const hal_timer_t next_isr_ticks, const hal_timer_t min_ticks) {
+    if (next_isr_ticks < min_ticks) {
+      late_count++;
+      late_histogram[bucket(min_ticks - next_isr_ticks)]++;
+    }
+    else
+      NOMORE(min_slack_ticks, next_isr_ticks - min_ticks);
+  }
+
+  static FORCE_INLINE void exhausted() { loops_exhausted++; }
+
+  static FORCE_INLINE void isr_done(const hal_timer_t start) {
+    const hal_timer_t ticks = now() - start;
+    isr_calls++;
+    isr_histogram[bucket(ticks)]++;
+    NOLESS(isr_max_ticks, ticks);
+  }
+
+  static void reset();
+  static void report();
+};
+
+extern StepperProfiler stepper_profiler;
+
+// Run a statement and charge the time it took to the given phase
+#define PROFILE_PHASE(P, V) do{ \
+  const hal_timer_t _phase_start = stepper_profiler.now(); \
+  V; \
+  stepper_profiler.phase(StepperProfiler::P, _phase_start); \
+}while(0)
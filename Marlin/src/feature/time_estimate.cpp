@@ -0,0 +1,149 @@
+/**
+ * Marlin 3D Printer Firmware
+ * Copyright (c) 2020 MarlinFirmware [https://github.com/MarlinFirmware/Marlin]
+ *
+ * Based on Sprinter and grbl.
+ * Copyright (c) 2011 Camiel Gubbels / Erik van der Zalm
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+
+/**
+ * time_estimate.cpp - Time left in an SD print, from the planned move times
+ */
+
+#include "../inc/MarlinConfig.h"
+
+#if ENABLED(PRINT_TIME_ESTIMATE)
+
+#include "time_estimate.h"
+#include "../module/motion.h"
+#include "../module/printcounter.h"
+#include "../module/stepper.h"
+#include "../sd/cardreader.h"
+#include "../libs/duration_t.h"
+
+// Don't estimate until there's this much move time to go on
+#define MIN_MOVE_SECS 10
+
+TimeEstimate time_estimate;
+
+volatile uint32_t TimeEstimate::block_us, TimeEstimate::block_sdpos;
+uint32_t TimeEstimate::last_us;
+millis_t TimeEstimate::next_tick_ms;
+
+bool TimeEstimate::started;
+float TimeEstimate::move_secs, TimeEstimate::norm_secs;
+uint32_t TimeEstimate::start_sdpos, TimeEstimate::sdpos, TimeEstimate::start_secs;
+
+bool TimeEstimate::has_host;
+uint32_t TimeEstimate::host_secs, TimeEstimate::host_at;
+
+/**
+ * Start over for a new print
+ */
+void TimeEstimate::reset() {
+  last_us = block_us;
+  started = has_host = false;
+  move_secs = norm_secs = 0;
+}
+
+/**
+ * Add up the move time of the blocks started in the last second
+ */
+void TimeEstimate::tick() {
+  const millis_t ms = millis();
+  if (PENDING(ms, next_tick_ms)) return;
+  next_tick_ms = ms + 1000UL;
+
+  #ifdef __AVR__
+    // Protect the access to the variables. Only required for AVR, as
+    //  any 32bit CPU offers atomic access to 32bit variables
+    const bool was_enabled = stepper.suspend();
+  #endif
+
+  const uint32_t us = block_us, pos = block_sdpos;
+
+  #ifdef __AVR__
+    if (was_enabled) stepper.wake_up();
+  #endif
+
+  const uint32_t new_us = us - last_us;
+  last_us = us;
+  if (!new_us || !card.isFileOpen()) return;
+
+  if (started) {
+    const float secs = new_us * 0.000001f;
+    move_secs += secs;
+    norm_secs += secs * feedrate_percentage * 0.01f;
+  }
+  else {
+    // Count from the end of the first moves, after any heating
+    started = true;
+    start_sdpos = pos;
+    start_secs = print_job_timer.duration();
+  }
+  sdpos = pos;
+}
+
+/**
+ * M73 R<minutes> gives the time left from here
+ */
+void TimeEstimate::set_remaining(const uint32_t secs) {
+  has_host = true;
+  host_secs = secs;
+  host_at = print_job_timer.duration();
+}
+
+/**
+ * Get the estimated seconds left in the print, or 0 if there's nothing to go on
+ */
+uint32_t TimeEstimate::remaining() {
+  const uint32_t now = print_job_timer.duration();
+
+  float host_left = 0;
+  if (has_host) {
+    const uint32_t since = now - host_at;
+    if (since < host_secs) host_left = host_secs - since;
+  }
+
+  const uint32_t size = card.getFileSize();
+  if (!started || move_secs < MIN_MOVE_SECS || sdpos <= start_sdpos || sdpos >= size || !card.isFileOpen())
+    return host_left;
+
+  const float print_per_move = (now - start_secs) / move_secs,
+              move_per_byte = norm_secs / (sdpos - start_sdpos) * 100 / _MAX(feedrate_percentage, 1),
+              left = print_per_move * move_per_byte * (size - sdpos);
+
+  if (!has_host) return left;
+
+  // The host knows the rest of the file, the estimate knows this machine
+  const float done = float(sdpos) / size;
+  return done * left + (1 - done) * host_left;
+}
+
+void TimeEstimate::report() {
+  SERIAL_ECHO_START();
+  const uint32_t secs = remaining();
+  if (secs) {
+    char buffer[21];
+    duration_t(secs).toString(buffer);
+    SERIAL_ECHOLNPAIR("Print time left: ", buffer);
+  }
+  else
+    SERIAL_ECHOLNPGM("Print time left: unknown");
+}
+
+#endif // PRINT_TIME_ESTIMATE
@@ -0,0 +1,77 @@
+/**
+ * Marlin 3D Printer Firmware
+ * Copyright (c) 2020 MarlinFirmware [https://github.com/MarlinFirmware/Marlin]
+ *
+ * Based on Sprinter and grbl.
+ * Copyright (c) 2011 Camiel Gubbels / Erik van der Zalm
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+#pragma once
+
+/**
+ * time_estimate.h - Time left in an SD print, from the planned move times
+ *
+ * The planner works out how long each block's trapezoid will take. As the
+ * Stepper ISR starts a block its time is added up along with the file
+ * position of the command that made it. From the first move on, that gives
+ *
+ *   - move seconds per byte of the file at 100% feedrate, to convert the
+ *     bytes left to time at the current M220 feedrate
+ *   - print seconds per move second, to cover heating, dwells, and the
+ *     other commands between moves
+ *
+ * Heating before the first move isn't counted, as it won't happen again.
+ *
+ * A remaining time sent with M73 R (by the host, or by the slicer in the
+ * file) counts down from when it was sent. With both, the M73 time is
+ * weighted by the part of the file still to go and the estimate by the
+ * part done, as the slicer knows the rest of the file and the estimate
+ * only knows this machine.
+ */
+
+#include "../inc/MarlinConfigPre.h"
+#include "../core/millis_t.h"
+
+class TimeEstimate {
+public:
+  static void reset();
+  static void tick();
+  static void set_remaining(const uint32_t secs);
+  static uint32_t remaining();
+  static void report();
+
+  // Called by the Stepper ISR as it starts each block
+  FORCE_INLINE static void block_started(const uint32_t us, const uint32_t sdpos) {
+    if (us) { block_us += us; block_sdpos = sdpos; }
+  }
+
+private:
+  static volatile uint32_t block_us,    // Move time of the blocks started, wrapping
+                           block_sdpos; // File position of the last block started
+  static uint32_t last_us;              // block_us at the last tick
+  static millis_t next_tick_ms;
+
+  static bool started;                  // Moves have run since reset
+  static float move_secs,               // Move time since the first tick with moves
+               norm_secs;               // The same at 100% feedrate
+  static uint32_t start_sdpos, sdpos,   // File positions of the first and last moves
+                  start_secs;           // Print time at the first move
+
+  static bool has_host;
+  static uint32_t host_secs, host_at;   // M73 R, and the print time it was sent at
+};
+
+extern TimeEstimate time_estimate;
@@ -136,7 +136,11 @@
 #define G26_ERR true
 
 #if ENABLED(ARC_SUPPORT)
-  void plan_arc(const xyze_pos_t &cart, const ab_float_t &offset, const uint8_t clockwise);
+  void plan_arc(const xyze_pos_t &cart, const ab_float_t &offset, const uint8_t clockwise
+    #if ENABLED(ARC_P_CIRCLES)
+      , const int8_t circles=0
+    #endif
+  );
 #endif
 
 constexpr float g26_e_axis_feedrate = 0.025;
@@ -786,6 +790,7 @@ void GcodeSuite::G26() {
         const feedRate_t old_feedrate = feedrate_mm_s;
         feedrate_mm_s = PLANNER_XY_FEEDRATE() * 0.1f;
         plan_arc(endpoint, arc_offset, false);  // Draw a counter-clockwise arc
+        planner.finish_segments();
         feedrate_mm_s = old_feedrate;
         destination = current_position;
 
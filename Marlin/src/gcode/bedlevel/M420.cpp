@@ -33,6 +33,10 @@
   #include "../../module/configuration_store.h"
 #endif
 
+#if ENABLED(MESH_BICUBIC)
+  #include "../../feature/bedlevel/mesh_cells.h"
+#endif
+
 #if ENABLED(EXTENSIBLE_UI)
   #include "../../lcd/extui/ui_api.h"
 #endif
@@ -55,6 +59,10 @@
  *
  *   C         Center mesh on the mean of the lowest and highest
  *
+ * With MESH_BICUBIC:
+ *
+ *   B[bool]   Bicubic (1) or bilinear (0) interpolation of the mesh
+ *
  * With MARLIN_DEV_MODE:
  *   S2        Create a simple random mesh and enable
  */
@@ -75,6 +83,11 @@ void GcodeSuite::M420() {
         Z_VALUES(x, y) = 0.001 * random(-200, 200);
         TERN_(EXTENSIBLE_UI, ExtUI::onMeshUpdate(x, y, Z_VALUES(x, y)));
       }
+      #if ENABLED(AUTO_BED_LEVELING_BILINEAR)
+        refresh_bed_level();
+      #elif ENABLED(MESH_CELL_CACHE)
+        refresh_mesh_cells();
+      #endif
       SERIAL_ECHOPGM("Simulated " STRINGIFY(GRID_MAX_POINTS_X) "x" STRINGIFY(GRID_MAX_POINTS_Y) " mesh ");
       SERIAL_ECHOPAIR(" (", x_min);
       SERIAL_CHAR(','); SERIAL_ECHO(y_min);
@@ -213,6 +226,17 @@ void GcodeSuite::M420() {
     if (parser.seen('Z')) set_z_fade_height(parser.value_linear_units(), false);
   #endif
 
+  #if ENABLED(MESH_BICUBIC)
+    if (parser.seen('B')) {
+      const bool bicubic = parser.value_bool();
+      if (bicubic != mesh_bicubic) {
+        // Turn off with the old cells. They're rebuilt when leveling goes back on.
+        set_bed_leveling_enabled(false);
+        mesh_bicubic = bicubic;
+      }
+    }
+  #endif
+
   // Enable leveling if specified, or if previously active
   set_bed_leveling_enabled(to_enable);
 
@@ -228,6 +252,12 @@ void GcodeSuite::M420() {
   SERIAL_ECHOPGM("Bed Leveling ");
   serialprintln_onoff(planner.leveling_active);
 
+  #if ENABLED(MESH_BICUBIC)
+    SERIAL_ECHO_START();
+    SERIAL_ECHOPGM("Bicubic Mesh ");
+    serialprintln_onoff(mesh_bicubic);
+  #endif
+
   #if ENABLED(ENABLE_LEVELING_FADE_HEIGHT)
     SERIAL_ECHO_START();
     SERIAL_ECHOPGM("Fade Height ");
@@ -53,6 +53,10 @@
   #include "../../../libs/vector_3.h"
 #endif
 
+#if ENABLED(PROBE_ROUTE)
+  #include "../../../feature/bedlevel/probe_route.h"
+#endif
+
 #define DEBUG_OUT ENABLED(DEBUG_LEVELING_FEATURE)
 #include "../../../core/debug_out.h"
 
@@ -602,83 +606,109 @@ G29_TYPE GcodeSuite::G29() {
 
     #if ABL_GRID
 
-      bool zig = PR_OUTER_END & 1;  // Always end at RIGHT and BACK_PROBE_BED_POSITION
-
       measured_z = 0;
 
       xy_int8_t meshCount;
 
-      // Outer loop is X with PROBE_Y_FIRST enabled
-      // Outer loop is Y with PROBE_Y_FIRST disabled
-      for (PR_OUTER_VAR = 0; PR_OUTER_VAR < PR_OUTER_END && !isnan(measured_z); PR_OUTER_VAR++) {
+      // Probe the point at meshCount. Return false to stop probing.
+      auto probe_grid_point = [&](const uint8_t pt_index) {
+        probePos = probe_position_lf + gridSpacing * meshCount.asFloat();
 
-        int8_t inStart, inStop, inInc;
+        TERN_(AUTO_BED_LEVELING_LINEAR, indexIntoAB[meshCount.x][meshCount.y] = ++abl_probe_index); // 0...
 
-        if (zig) {                    // Zig away from origin
-          inStart = 0;                // Left or front
-          inStop = PR_INNER_END;      // Right or back
-          inInc = 1;                  // Zig right
-        }
-        else {                        // Zag towards origin
-          inStart = PR_INNER_END - 1; // Right or back
-          inStop = -1;                // Left or front
-          inInc = -1;                 // Zag left
+        // Avoid probing outside the round or hexagonal area
+        if (TERN0(IS_KINEMATIC, !probe.can_reach(probePos))) return true;
+
+        if (verbose_level) SERIAL_ECHOLNPAIR("Probing mesh point ", int(pt_index), "/", abl_points, ".");
+        TERN_(HAS_DISPLAY, ui.status_printf_P(0, PSTR(S_FMT " %i/%i"), GET_TEXT(MSG_PROBING_MESH), int(pt_index), int(abl_points)));
+
+        measured_z = faux ? 0.001f * random(-100, 101) : probe.probe_at_point(probePos, raise_after, verbose_level);
+
+        if (isnan(measured_z)) {
+          set_bed_leveling_enabled(abl_should_enable);
+          return false;
         }
 
-        zig ^= true; // zag
+        #if ENABLED(PROBE_TEMP_COMPENSATION)
+          temp_comp.compensate_measurement(TSI_BED, thermalManager.degBed(), measured_z);
+          temp_comp.compensate_measurement(TSI_PROBE, thermalManager.degProbe(), measured_z);
+          TERN_(USE_TEMP_EXT_COMPENSATION, temp_comp.compensate_measurement(TSI_EXT, thermalManager.degHotend(), measured_z));
+        #endif
 
-        // An index to print current state
-        uint8_t pt_index = (PR_OUTER_VAR) * (PR_INNER_END) + 1;
+        #if ENABLED(AUTO_BED_LEVELING_LINEAR)
 
-        // Inner loop is Y with PROBE_Y_FIRST enabled
-        // Inner loop is X with PROBE_Y_FIRST disabled
-        for (PR_INNER_VAR = inStart; PR_INNER_VAR != inStop; pt_index++, PR_INNER_VAR += inInc) {
+          mean += measured_z;
+          eqnBVector[abl_probe_index] = measured_z;
+          eqnAMatrix[abl_probe_index + 0 * abl_points] = probePos.x;
+          eqnAMatrix[abl_probe_index + 1 * abl_points] = probePos.y;
+          eqnAMatrix[abl_probe_index + 2 * abl_points] = 1;
 
-          probePos = probe_position_lf + gridSpacing * meshCount.asFloat();
+          incremental_LSF(&lsf_results, probePos, measured_z);
 
-          TERN_(AUTO_BED_LEVELING_LINEAR, indexIntoAB[meshCount.x][meshCount.y] = ++abl_probe_index); // 0...
+        #elif ENABLED(AUTO_BED_LEVELING_BILINEAR)
 
-          // Avoid probing outside the round or hexagonal area
-          if (TERN0(IS_KINEMATIC, !probe.can_reach(probePos))) continue;
+          z_values[meshCount.x][meshCount.y] = measured_z + zoffset;
+          TERN_(EXTENSIBLE_UI, ExtUI::onMeshUpdate(meshCount, z_values[meshCount.x][meshCount.y]));
+          TERN_(DWIN_CREALITY_LCD,BLtouch_detecting(meshCount.x,meshCount.y));
+        #endif
 
-          if (verbose_level) SERIAL_ECHOLNPAIR("Probing mesh point ", int(pt_index), "/", abl_points, ".");
-          TERN_(HAS_DISPLAY, ui.status_printf_P(0, PSTR(S_FMT " %i/%i"), GET_TEXT(MSG_PROBING_MESH), int(pt_index), int(abl_points)));
+        abl_should_enable = false;
+        idle_no_sleep();
+        return true;
+      };
+
+      #if ENABLED(PROBE_ROUTE)
+
+        // Probe the points in the order that needs the least travel
+        ProbeRoute route(probe_position_lf, gridSpacing);
+        LOOP_L_N(x, abl_grid_points.x) LOOP_L_N(i, abl_grid_points.y) {
+          route.add(x, x & 1 ? abl_grid_points.y - 1 - i : i);   // Serpentine
+          // Leave out points outside the round or hexagonal area
+          if (TERN0(IS_KINEMATIC, !probe.can_reach(route.pos(route.count - 1)))) route.count--;
+        }
 
-          measured_z = faux ? 0.001f * random(-100, 101) : probe.probe_at_point(probePos, raise_after, verbose_level);
+        const float travel = route.plan(current_position + probe.offset_xy);
+        if (verbose_level) route.report(travel);
 
-          if (isnan(measured_z)) {
-            set_bed_leveling_enabled(abl_should_enable);
-            break; // Breaks out of both loops
-          }
+        LOOP_L_N(i, route.count) {
+          meshCount.set(route.point[i].x, route.point[i].y);
+          if (!probe_grid_point(i + 1)) break;
+        }
+
+      #else
 
-          #if ENABLED(PROBE_TEMP_COMPENSATION)
-            temp_comp.compensate_measurement(TSI_BED, thermalManager.degBed(), measured_z);
-            temp_comp.compensate_measurement(TSI_PROBE, thermalManager.degProbe(), measured_z);
-            TERN_(USE_TEMP_EXT_COMPENSATION, temp_comp.compensate_measurement(TSI_EXT, thermalManager.degHotend(), measured_z));
-          #endif
+        bool zig = PR_OUTER_END & 1;  // Always end at RIGHT and BACK_PROBE_BED_POSITION
 
-          #if ENABLED(AUTO_BED_LEVELING_LINEAR)
+        // Outer loop is X with PROBE_Y_FIRST enabled
+        // Outer loop is Y with PROBE_Y_FIRST disabled
+        for (PR_OUTER_VAR = 0; PR_OUTER_VAR < PR_OUTER_END && !isnan(measured_z); PR_OUTER_VAR++) {
 
-            mean += measured_z;
-            eqnBVector[abl_probe_index] = measured_z;
-            eqnAMatrix[abl_probe_index + 0 * abl_points] = probePos.x;
-            eqnAMatrix[abl_probe_index + 1 * abl_points] = probePos.y;
-            eqnAMatrix[abl_probe_index + 2 * abl_points] = 1;
+          int8_t inStart, inStop, inInc;
 
-            incremental_LSF(&lsf_results, probePos, measured_z);
+          if (zig) {                    // Zig away from origin
+            inStart = 0;                // Left or front
+            inStop = PR_INNER_END;      // Right or back
+            inInc = 1;                  // Zig right
+          }
+          else {                        // Zag towards origin
+            inStart = PR_INNER_END - 1; // Right or back
+            inStop = -1;                // Left or front
+            inInc = -1;                 // Zag left
+          }
 
-          #elif ENABLED(AUTO_BED_LEVELING_BILINEAR)
+          zig ^= true; // zag
 
-            z_values[meshCount.x][meshCount.y] = measured_z + zoffset;
-            TERN_(EXTENSIBLE_UI, ExtUI::onMeshUpdate(meshCount, z_values[meshCount.x][meshCount.y]));
-            TERN_(DWIN_CREALITY_LCD,BLtouch_detecting(meshCount.x,meshCount.y));
-          #endif
+          // An index to print current state
+          uint8_t pt_index = (PR_OUTER_VAR) * (PR_INNER_END) + 1;
 
-          abl_should_enable = false;
-          idle_no_sleep();
+          // Inner loop is Y with PROBE_Y_FIRST enabled
+          // Inner loop is X with PROBE_Y_FIRST disabled
+          for (PR_INNER_VAR = inStart; PR_INNER_VAR != inStop; pt_index++, PR_INNER_VAR += inInc)
+            if (!probe_grid_point(pt_index)) break;
 
-        } // inner
-      } // outer
+        } // outer
+
+      #endif
 
     #elif ENABLED(AUTO_BED_LEVELING_3POINT)
 
@@ -31,6 +31,9 @@
 #include "../../gcode.h"
 #include "../../../feature/bedlevel/bedlevel.h"
 
-void GcodeSuite::G29() { ubl.G29(); }
+void GcodeSuite::G29() {
+  ubl.G29();
+  TERN_(MESH_CELL_CACHE, refresh_mesh_cells()); // For mesh edits made with leveling on
+}
 
 #endif // AUTO_BED_LEVELING_UBL
@@ -0,0 +1,83 @@
+/**
+ * Marlin 3D Printer Firmware
+ * Copyright (c) 2020 MarlinFirmware [https://github.com/MarlinFirmware/Marlin]
+ *
+ * Based on Sprinter and grbl.
+ * Copyright (c) 2011 Camiel Gubbels / Erik van der Zalm
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+#pragma once
+
+/**
+ * binary_gcode.h - Pre-tokenized G-code commands
+ *
+ * A binary command carries the command code and parameter values that
+ * GCodeParser would get from an ASCII line, so it goes into the parser
+ * with no text to scan or numbers to convert. All fields are little-endian.
+ *
+ *   type     1 byte  : 1LLSWFN0
+ *                        1  : Always set. ASCII never starts with such a byte.
+ *                        LL : Command letter. 0=G, 1=M, 2=T
+ *                        S  : A subcode byte follows the code
+ *                        W  : The code is 16 bits wide
+ *                        F  : Values are fixed-point, int32 / 1000 (else float)
+ *                        N  : Letters with no value follow the value mask
+ *   code     1|2     : Command code, e.g., 1 for G1
+ *   subcode  0|1     : e.g., 1 for G29.1
+ *   values   4 bytes : Bit n set for each letter 'A'+n with a value
+ *   novalue  0|4     : Bit n set for each letter 'A'+n with no value
+ *   ...      4 bytes : One value for each bit of the value mask, from 'A' up
+ *
+ * "G1 X10.5 Y20 E0.25 F3000" is 22 bytes, "G28 X Y" is 10.
+ * A whole command has to fit in a queue slot of MAX_CMD_SIZE bytes.
+ * Commands with a string argument (M23, M117...) must be sent as ASCII.
+ *
+ * SD files may mix binary commands with ASCII lines. Over the binary
+ * transfer protocol (M28 B1) they are sent as Protocol::GCODE packets.
+ */
+
+#include "../inc/MarlinConfig.h"
+
+#define BGC_MARK          0x80
+#define BGC_LETTER_SHIFT  5
+#define BGC_SUBCODE       0x10
+#define BGC_CODE16        0x08
+#define BGC_FIXED         0x04
+#define BGC_NOVALUE       0x02
+
+#define BGC_FIXED_SCALE   1000
+
+class BinaryGCode {
+public:
+  FORCE_INLINE static bool is_command(const char * const p) { return TEST(*p, 7); }
+
+  // Bytes up to the values, known from the type byte
+  static inline uint8_t header_size(const uint8_t type) {
+    return 6 + !!(type & BGC_CODE16) + !!(type & BGC_SUBCODE) + ((type & BGC_NOVALUE) ? 4 : 0);
+  }
+
+  // The value mask, with the header at p
+  static inline uint32_t value_mask(const uint8_t * const p) {
+    uint32_t mask;
+    memcpy(&mask, p + 2 + !!(p[0] & BGC_CODE16) + !!(p[0] & BGC_SUBCODE), sizeof(mask));
+    return mask;
+  }
+
+  // The size of a whole command, with the header at p
+  static inline uint8_t size(const uint8_t * const p) {
+    return header_size(p[0]) + 4 * __builtin_popcountl(value_mask(p));
+  }
+};
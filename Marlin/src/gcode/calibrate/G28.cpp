@@ -58,6 +58,10 @@
   #include "../../feature/spindle_laser.h"
 #endif
 
+#if ENABLED(INPUT_SHAPING)
+  #include "../../feature/input_shaping.h"
+#endif
+
 #define DEBUG_OUT ENABLED(DEBUG_LEVELING_FEATURE)
 #include "../../core/debug_out.h"
 
@@ -238,6 +242,9 @@ void GcodeSuite::G28() {
 
   TERN_(CNC_WORKSPACE_PLANES, workspace_plane = PLANE_XY);
 
+  // Endstops must trigger where the steps were counted, so home without shaping
+  TERN_(INPUT_SHAPING, input_shaping.suspend(true));
+
   // Count this command as movement / activity
   reset_stepper_timeout();
 
@@ -432,6 +439,8 @@ void GcodeSuite::G28() {
 
   TERN_(RESTORE_LEVELING_AFTER_G28, set_bed_leveling_enabled(leveling_was_active));
 
+  TERN_(INPUT_SHAPING, input_shaping.suspend(false));
+
   restore_feedrate_and_scaling();
 
   // Restore the active tool after homing
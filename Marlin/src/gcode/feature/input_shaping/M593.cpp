@@ -0,0 +1,75 @@
+/**
+ * Marlin 3D Printer Firmware
+ * Copyright (c) 2020 MarlinFirmware [https://github.com/MarlinFirmware/Marlin]
+ *
+ * Based on Sprinter and grbl.
+ * Copyright (c) 2011 Camiel Gubbels / Erik van der Zalm
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+
+#include "../../../inc/MarlinConfigPre.h"
+
+#if ENABLED(INPUT_SHAPING)
+
+#include "../../gcode.h"
+#include "../../../feature/input_shaping.h"
+
+static void M593_report() {
+  LOOP_L_N(a, SHAPING_AXES) {
+    const shaper_settings_t &s = input_shaping.axis[a].settings;
+    SERIAL_ECHOPGM("Input shaping ");
+    SERIAL_CHAR(axis_codes[a]);
+    SERIAL_ECHOPAIR(" F", s.frequency, " D", s.zeta, " T", int(s.type));
+    if (input_shaping.suspended) SERIAL_ECHOPGM(" (suspended)");
+    SERIAL_EOL();
+  }
+}
+
+/**
+ * M593: Set or report input shaping for X and Y
+ *
+ *  X / Y       Set only this axis. (Default both)
+ *  F<freq>     Ringing frequency in Hz. 0 turns shaping off.
+ *  D<zeta>     Damping ratio, 0.0-0.99
+ *  T<type>     Shaper: 0=ZV 1=ZVD 2=MZV 3=EI
+ *
+ * With no F, D, or T report the settings.
+ * Waits for moves to finish before changing the shapers.
+ */
+void GcodeSuite::M593() {
+  if (!parser.seen("FDT")) return M593_report();
+
+  const bool seen_x = parser.seen('X'), seen_y = parser.seen('Y'),
+             for_x = seen_x || !seen_y, for_y = seen_y || !seen_x;
+
+  const float f = parser.floatval('F', -1), d = parser.floatval('D', -1);
+  const int16_t t = parser.intval('T', -1);
+  if (parser.seen('F') && f != 0 && !WITHIN(f, 1, 500)) { SERIAL_ECHOLNPGM("?Frequency (F) must be 0 or 1-500."); return; }
+  if (parser.seen('D') && !WITHIN(d, 0, 0.99f))        { SERIAL_ECHOLNPGM("?Damping (D) must be 0.0-0.99."); return; }
+  if (parser.seen('T') && !WITHIN(t, 0, SHAPER_COUNT - 1)) { SERIAL_ECHOLNPGM("?Shaper (T) must be 0-3."); return; }
+
+  LOOP_L_N(a, SHAPING_AXES) {
+    if (!(a == X_AXIS ? for_x : for_y)) continue;
+    shaper_settings_t &s = input_shaping.axis[a].settings;
+    if (parser.seen('F')) s.frequency = f;
+    if (parser.seen('D')) s.zeta = d;
+    if (parser.seen('T')) s.type = ShaperType(t);
+  }
+
+  input_shaping.refresh();
+}
+
+#endif // INPUT_SHAPING
@@ -0,0 +1,90 @@
+/**
+ * Marlin 3D Printer Firmware
+ * Copyright (c) 2020 MarlinFirmware [https://github.com/MarlinFirmware/Marlin]
+ *
+ * Based on Sprinter and grbl.
+ * Copyright (c) 2011 Camiel Gubbels / Erik van der Zalm
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+
+#include "../../../inc/MarlinConfig.h"
+
+#if ENABLED(PLANNER_BENCHMARK)
+
+#include "../../gcode.h"
+#include "../../../module/motion.h"
+#include "../../../module/planner.h"
+#include "../../../module/stepper.h"
+
+// Hand the oldest block to a pretend Stepper ISR and drop it
+static inline void consume_block() {
+  if (planner.get_current_block()) planner.release_current_block();
+}
+
+/**
+ * M124: Benchmark the planner
+ *
+ * Plans a circle of short segments around the current XY position with
+ * the Stepper ISR paused. Once the buffer is full the oldest block is
+ * dropped before each new one, so every segment is planned against a
+ * full look-ahead queue. Nothing moves. Reports the blocks planned per
+ * second for comparison between builds and buffer sizes.
+ *
+ *   P<count>  : Number of segments to plan (Default 1000)
+ *   S<mm>     : Segment length (Default 0.5)
+ *   R<radius> : Circle radius (Default 10)
+ *   F<feed>   : Feedrate in mm/min (Default 6000)
+ */
+void GcodeSuite::M124() {
+  const uint16_t count = parser.ushortval('P', 1000);
+  const float seg_len = parser.floatval('S', 0.5f),
+              radius = parser.floatval('R', 10),
+              step_angle = seg_len / radius;
+  const feedRate_t fr_mm_s = MMM_TO_MMS(parser.floatval('F', 6000));
+
+  if (!count || seg_len <= 0 || radius <= 0 || fr_mm_s <= 0) return;
+
+  planner.synchronize();
+  const bool was_enabled = stepper.suspend();
+
+  xyze_pos_t pos = current_position;
+  const xy_pos_t center = current_position;
+  pos.x += radius;
+  planner.buffer_line(pos, fr_mm_s, active_extruder);
+
+  uint16_t planned = 0;
+  const millis_t start_us = micros();
+  for (uint16_t i = 1; i <= count; i++) {
+    // Leave room for a block that gets split in two
+    while (planner.moves_free() < 2) consume_block();
+    const float angle = i * step_angle;
+    pos.x = center.x + radius * cos(angle);
+    pos.y = center.y + radius * sin(angle);
+    if (planner.buffer_line(pos, fr_mm_s, active_extruder)) planned++;
+  }
+  const millis_t elapsed_us = micros() - start_us;
+
+  // Nothing was stepped, so drop the rest and put the planner back where the steppers are
+  while (planner.has_blocks_queued()) consume_block();
+  sync_plan_position();
+  if (was_enabled) stepper.wake_up();
+
+  SERIAL_ECHOPAIR("Planned ", planned, " blocks in ", elapsed_us, "us (Buffer size ", int(BLOCK_BUFFER_SIZE), ")");
+  if (elapsed_us) SERIAL_ECHOPAIR(" ", uint32_t(planned * 1000000.0f / elapsed_us), " blocks/s");
+  SERIAL_EOL();
+}
+
+#endif // PLANNER_BENCHMARK
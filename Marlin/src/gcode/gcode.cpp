@@ -57,6 +57,14 @@ GcodeSuite gcode;
   #include "../feature/spindle_laser.h"
 #endif
 
+#if HAS_SEGMENT_GENERATOR
+  #include "../module/planner.h"
+#endif
+
+#if ENABLED(BINARY_GCODE)
+  #include "binary_gcode.h"
+#endif
+
 #include "../MarlinCore.h" // for idle()
 
 // Inactivity shutdown
@@ -241,6 +249,9 @@ void GcodeSuite::dwell(millis_t time) {
 void GcodeSuite::process_parsed_command(const bool no_ok/*=false*/) {
   KEEPALIVE_STATE(IN_HANDLER);
 
+  // A sub-command may follow a curve that's still being buffered
+  TERN_(HAS_SEGMENT_GENERATOR, planner.finish_segments());
+
   // Handle a known G, M, or T
   switch (parser.command_letter) {
     case 'G': switch (parser.codenum) {
@@ -448,7 +459,7 @@ void GcodeSuite::process_parsed_command(const bool no_ok/*=false*/) {
         case 48: M48(); break;                                    // M48: Z probe repeatability test
       #endif
 
-      #if ENABLED(LCD_SET_PROGRESS_MANUALLY)
+      #if EITHER(LCD_SET_PROGRESS_MANUALLY, PRINT_TIME_ESTIMATE)
         case 73: M73(); break;                                    // M73: Set progress percentage (for display on LCD)
       #endif
 
@@ -544,6 +555,14 @@ void GcodeSuite::process_parsed_command(const bool no_ok/*=false*/) {
       case 120: M120(); break;                                    // M120: Enable endstops
       case 121: M121(); break;                                    // M121: Disable endstops
 
+      #if ENABLED(STEPPER_ISR_PROFILER)
+        case 123: M123(); break;                                  // M123: Report the Stepper ISR profile
+      #endif
+
+      #if ENABLED(PLANNER_BENCHMARK)
+        case 124: M124(); break;                                  // M124: Benchmark the planner
+      #endif
+
       #if PREHEAT_COUNT
         case 145: M145(); break;                                  // M145: Set material heatup parameters
       #endif
@@ -748,6 +767,14 @@ void GcodeSuite::process_parsed_command(const bool no_ok/*=false*/) {
         case 575: M575(); break;                                  // M575: Set serial baudrate
       #endif
 
+      #if ENABLED(SERIAL_WINDOW_ACK)
+        case 576: M576(); break;                                  // M576: Set serial window
+      #endif
+
+      #if ENABLED(INPUT_SHAPING)
+        case 593: M593(); break;                                  // M593: Set input shaping
+      #endif
+
       #if ENABLED(ADVANCED_PAUSE_FEATURE)
         case 600: M600(); break;                                  // M600: Pause for Filament Change
         case 603: M603(); break;                                  // M603: Configure Filament Change
@@ -921,6 +948,9 @@ void GcodeSuite::process_next_command() {
 
   if (DEBUGGING(ECHO)) {
     SERIAL_ECHO_START();
+    #if ENABLED(BINARY_GCODE)
+      if (BinaryGCode::is_command(current_command)) SERIAL_ECHOLNPGM("(binary command)"); else
+    #endif
     SERIAL_ECHOLN(current_command);
     #if ENABLED(M100_FREE_MEMORY_DUMPER)
       SERIAL_ECHOPAIR("slot:", queue.index_r);
@@ -112,7 +112,7 @@
  * M42  - Change pin status via gcode: M42 P<pin> S<value>. LED pin assumed if P is omitted.
  * M43  - Display pin status, watch pins for changes, watch endstops & toggle LED, Z servo probe test, toggle pins
  * M48  - Measure Z Probe repeatability: M48 P<points> X<pos> Y<pos> V<level> E<engage> L<legs> S<chizoid>. (Requires Z_MIN_PROBE_REPEATABILITY_TEST)
- * M73  - Set the progress percentage. (Requires LCD_SET_PROGRESS_MANUALLY)
+ * M73  - Set the progress percentage. (Requires LCD_SET_PROGRESS_MANUALLY) Report the print time left. (Requires PRINT_TIME_ESTIMATE)
  * M75  - Start the print job timer.
  * M76  - Pause the print job timer.
  * M77  - Stop the print job timer.
@@ -146,6 +146,8 @@
  * M120 - Enable endstops detection.
  * M121 - Disable endstops detection.
  * M122 - Debug stepper (Requires at least one _DRIVER_TYPE defined as TMC2130/2160/5130/5160/2208/2209/2660 or L6470)
+ * M123 - Report the Stepper ISR profile. "M123 R" also resets it. (Requires STEPPER_ISR_PROFILER)
+ * M124 - Measure how fast the planner plans short segments with a full buffer. (Requires PLANNER_BENCHMARK)
  * M125 - Save current position and move to filament change position. (Requires PARK_HEAD_ON_PAUSE)
  * M126 - Solenoid Air Valve Open. (Requires BARICUDA)
  * M127 - Solenoid Air Valve Closed. (Requires BARICUDA)
@@ -228,6 +230,8 @@
  * M524 - Abort the current SD print job started with M24. (Requires SDSUPPORT)
  * M540 - Enable/disable SD card abort on endstop hit: "M540 S<state>". (Requires SD_ABORT_ON_ENDSTOP_HIT)
  * M569 - Enable stealthChop on an axis. (Requires at least one _DRIVER_TYPE to be TMC2130/2160/2208/2209/5130/5160)
+ * M576 - Set the serial window for streaming lines ahead of a cumulative "ok". (Requires SERIAL_WINDOW_ACK)
+ * M593 - Set or report input shaping: "M593 [X|Y] F<freq> D<zeta> T<type>". (Requires INPUT_SHAPING)
  * M600 - Pause for filament change: "M600 X<pos> Y<pos> Z<raise> E<first_retract> L<later_retract>". (Requires ADVANCED_PAUSE_FEATURE)
  * M603 - Configure filament change: "M603 T<tool> U<unload_length> L<load_length>". (Requires ADVANCED_PAUSE_FEATURE)
  * M605 - Set Dual X-Carriage movement mode: "M605 S<mode> [X<x_offset>] [R<temp_offset>]". (Requires DUAL_X_CARRIAGE)
@@ -541,7 +545,9 @@ private:
 
   TERN_(Z_MIN_PROBE_REPEATABILITY_TEST, static void M48());
 
-  TERN_(LCD_SET_PROGRESS_MANUALLY, static void M73());
+  #if EITHER(LCD_SET_PROGRESS_MANUALLY, PRINT_TIME_ESTIMATE)
+    static void M73();
+  #endif
 
   static void M75();
   static void M76();
@@ -591,6 +597,9 @@ private:
   static void M120();
   static void M121();
 
+  TERN_(STEPPER_ISR_PROFILER, static void M123());
+  TERN_(PLANNER_BENCHMARK, static void M124());
+
   TERN_(PARK_HEAD_ON_PAUSE, static void M125());
 
   #if ENABLED(BARICUDA)
@@ -763,6 +772,10 @@ private:
 
   TERN_(BAUD_RATE_GCODE, static void M575());
 
+  TERN_(SERIAL_WINDOW_ACK, static void M576());
+
+  TERN_(INPUT_SHAPING, static void M593());
+
   #if ENABLED(ADVANCED_PAUSE_FEATURE)
     static void M600();
     static void M603();
@@ -59,6 +59,9 @@ void GcodeSuite::M115() {
     // BINARY_FILE_TRANSFER (M28 B1)
     cap_line(PSTR("BINARY_FILE_TRANSFER"), ENABLED(BINARY_FILE_TRANSFER));
 
+    // SERIAL_WINDOW_ACK (M576)
+    cap_line(PSTR("SERIAL_WINDOW_ACK"), ENABLED(SERIAL_WINDOW_ACK));
+
     // EEPROM (M500, M501)
     cap_line(PSTR("EEPROM"), ENABLED(EEPROM_SETTINGS));
 
@@ -0,0 +1,43 @@
+/**
+ * Marlin 3D Printer Firmware
+ * Copyright (c) 2020 MarlinFirmware [https://github.com/MarlinFirmware/Marlin]
+ *
+ * Based on Sprinter and grbl.
+ * Copyright (c) 2011 Camiel Gubbels / Erik van der Zalm
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+
+#include "../../inc/MarlinConfig.h"
+
+#if ENABLED(SERIAL_WINDOW_ACK)
+
+#include "../gcode.h"
+#include "../queue.h"
+
+/**
+ * M576: Get or set the serial window of the port that sent it
+ *
+ *   S<lines> Optional. Lines the host may send ahead of the "ok" (0 to disable).
+ *            Limited to BUFSIZE. Each "ok N<line>" covers all lines up to N.
+ */
+void GcodeSuite::M576() {
+  const uint8_t pn = queue.command_port();
+  if (parser.seenval('S')) queue.set_ack_window(pn, parser.value_byte());
+  SERIAL_ECHO_START();
+  SERIAL_ECHOLNPAIR("M576 S", int(queue.ack_window[pn]));
+}
+
+#endif // SERIAL_WINDOW_ACK
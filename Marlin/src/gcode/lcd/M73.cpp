@@ -22,27 +22,41 @@
 
 #include "../../inc/MarlinConfig.h"
 
-#if ENABLED(LCD_SET_PROGRESS_MANUALLY)
+#if EITHER(LCD_SET_PROGRESS_MANUALLY, PRINT_TIME_ESTIMATE)
 
 #include "../gcode.h"
 #include "../../lcd/ultralcd.h"
 #include "../../sd/cardreader.h"
 
+#if ENABLED(PRINT_TIME_ESTIMATE)
+  #include "../../feature/time_estimate.h"
+#endif
+
 /**
  * M73: Set percentage complete (for display on LCD)
  *
  * Example:
  *   M73 P25 ; Set progress to 25%
+ *
+ * With PRINT_TIME_ESTIMATE:
+ *   M73 R<minutes> ; Time left in the print, as known to the host or slicer
+ *   M73            ; Report the estimated time left
  */
 void GcodeSuite::M73() {
-  if (parser.seen('P'))
-    ui.set_progress((PROGRESS_SCALE) > 1
-      ? parser.value_float() * (PROGRESS_SCALE)
-      : parser.value_byte()
-    );
+  #if ENABLED(LCD_SET_PROGRESS_MANUALLY)
+    if (parser.seen('P'))
+      ui.set_progress((PROGRESS_SCALE) > 1
+        ? parser.value_float() * (PROGRESS_SCALE)
+        : parser.value_byte()
+      );
+  #endif
   #if BOTH(LCD_SET_PROGRESS_MANUALLY, USE_M73_REMAINING_TIME)
     if (parser.seen('R')) ui.set_remaining_time(60 * parser.value_ulong());
   #endif
+  #if ENABLED(PRINT_TIME_ESTIMATE)
+    if (parser.seen('R')) time_estimate.set_remaining(60 * parser.value_ulong());
+    if (!parser.seen("PR")) time_estimate.report();
+  #endif
 }
 
-#endif // LCD_SET_PROGRESS_MANUALLY
+#endif // LCD_SET_PROGRESS_MANUALLY || PRINT_TIME_ESTIMATE
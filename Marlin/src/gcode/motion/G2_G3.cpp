@@ -40,43 +40,69 @@
   #define N_ARC_CORRECTION 1
 #endif
 
+#if ENABLED(CNC_WORKSPACE_PLANES)
+  static AxisEnum p_axis, q_axis, l_axis;
+#else
+  constexpr AxisEnum p_axis = X_AXIS, q_axis = Y_AXIS, l_axis = Z_AXIS;
+#endif
+
+/**
+ * The arc being buffered. plan_arc() sets it up and arc_segments() adds
+ * segments to the planner as blocks free up, so long arcs don't hold up
+ * the main loop.
+ */
+static struct {
+  xyze_pos_t raw,               // The last segment
+             target;            // End of the sweep
+  ab_float_t offset,            // Center of rotation relative to the start
+             rvec;              // Radius vector from center to the last segment
+  float center_P, center_Q, start_L,
+        theta_per_segment, linear_per_segment, extruder_per_segment,
+        sin_T, cos_T;
+  feedRate_t scaled_fr_mm_s;
+  uint16_t segments, index;
+  #if N_ARC_CORRECTION > 1
+    int8_t recalc_count;
+  #endif
+  #if ENABLED(SCARA_FEEDRATE_SCALING)
+    float inv_duration;
+  #endif
+  #if ENABLED(ARC_BLOCKS)
+    float radius, angular_travel, mm_of_travel;
+  #endif
+  #if ENABLED(ARC_P_CIRCLES)
+    xyze_pos_t cart;            // End of the last sweep, after full circles
+    int8_t circles;             // Full circles still to do
+    bool clockwise;
+  #endif
+} arc;
+
 /**
- * Plan an arc in 2 dimensions
+ * Set up one sweep of an arc in 2 dimensions, from arc.raw to 'cart'
  *
  * The arc is approximated by generating many small linear segments.
  * The length of each segment is configured in MM_PER_ARC_SEGMENT (Default 1mm)
+ * or from the ARC_CHORD_TOLERANCE, so larger arcs can use longer segments.
  * Arcs should only be made relatively large (over 5mm), as larger arcs with
  * larger segments will tend to be more efficient. Your slicer should have
  * options for G2/G3 arc generation. In future these options may be GCode tunable.
+ *
+ * Return false if the sweep is too short to move.
  */
-void plan_arc(
-  const xyze_pos_t &cart,   // Destination position
-  const ab_float_t &offset, // Center of rotation relative to current_position
-  const uint8_t clockwise   // Clockwise?
-) {
-  #if ENABLED(CNC_WORKSPACE_PLANES)
-    AxisEnum p_axis, q_axis, l_axis;
-    switch (gcode.workspace_plane) {
-      default:
-      case GcodeSuite::PLANE_XY: p_axis = X_AXIS; q_axis = Y_AXIS; l_axis = Z_AXIS; break;
-      case GcodeSuite::PLANE_YZ: p_axis = Y_AXIS; q_axis = Z_AXIS; l_axis = X_AXIS; break;
-      case GcodeSuite::PLANE_ZX: p_axis = Z_AXIS; q_axis = X_AXIS; l_axis = Y_AXIS; break;
-    }
-  #else
-    constexpr AxisEnum p_axis = X_AXIS, q_axis = Y_AXIS, l_axis = Z_AXIS;
-  #endif
+static bool start_sweep(const xyze_pos_t &cart, const uint8_t clockwise) {
+  const xyze_pos_t &start = arc.raw;
 
   // Radius vector from center to current location
-  ab_float_t rvec = -offset;
+  ab_float_t rvec = -arc.offset;
 
   const float radius = HYPOT(rvec.a, rvec.b),
-              center_P = current_position[p_axis] - rvec.a,
-              center_Q = current_position[q_axis] - rvec.b,
+              center_P = start[p_axis] - rvec.a,
+              center_Q = start[q_axis] - rvec.b,
               rt_X = cart[p_axis] - center_P,
               rt_Y = cart[q_axis] - center_Q,
-              start_L = current_position[l_axis],
+              start_L = start[l_axis],
               linear_travel = cart[l_axis] - start_L,
-              extruder_travel = cart.e - current_position.e;
+              extruder_travel = cart.e - start.e;
 
   // CCW angle of rotation between position and target from the circle center. Only one atan2() trig computation required.
   float angular_travel = ATAN2(rvec.a * rt_Y - rvec.b * rt_X, rvec.a * rt_X + rvec.b * rt_Y);
@@ -90,7 +116,7 @@ void plan_arc(
   if (clockwise) angular_travel -= RADIANS(360);
 
   // Make a circle if the angular rotation is 0 and the target is current position
-  if (angular_travel == 0 && current_position[p_axis] == cart[p_axis] && current_position[q_axis] == cart[q_axis]) {
+  if (angular_travel == 0 && start[p_axis] == cart[p_axis] && start[q_axis] == cart[q_axis]) {
     angular_travel = RADIANS(360);
     #ifdef MIN_ARC_SEGMENTS
       min_segments = MIN_ARC_SEGMENTS;
@@ -99,16 +125,17 @@ void plan_arc(
 
   const float flat_mm = radius * angular_travel,
               mm_of_travel = linear_travel ? HYPOT(flat_mm, linear_travel) : ABS(flat_mm);
-  if (mm_of_travel < 0.001f) return;
-
-  const feedRate_t scaled_fr_mm_s = MMS_SCALED(feedrate_mm_s);
+  if (mm_of_travel < 0.001f) return false;
 
   // Start with a nominal segment length
   float seg_length = (
-    #ifdef ARC_SEGMENTS_PER_R
+    #ifdef ARC_CHORD_TOLERANCE
+      // The longest chord that strays no more than the tolerance from the arc
+      radius > (ARC_CHORD_TOLERANCE) ? _MAX(2 * SQRT((ARC_CHORD_TOLERANCE) * (2 * radius - (ARC_CHORD_TOLERANCE))), MM_PER_ARC_SEGMENT) : MM_PER_ARC_SEGMENT
+    #elif defined(ARC_SEGMENTS_PER_R)
       constrain(MM_PER_ARC_SEGMENT * radius, MM_PER_ARC_SEGMENT, ARC_SEGMENTS_PER_R)
     #elif ARC_SEGMENTS_PER_SEC
-      _MAX(scaled_fr_mm_s * RECIPROCAL(ARC_SEGMENTS_PER_SEC), MM_PER_ARC_SEGMENT)
+      _MAX(arc.scaled_fr_mm_s * RECIPROCAL(ARC_SEGMENTS_PER_SEC), MM_PER_ARC_SEGMENT)
     #else
       MM_PER_ARC_SEGMENT
     #endif
@@ -147,103 +174,197 @@ void plan_arc(
    * This is important when there are successive arc motions.
    */
   // Vector rotation matrix values
-  xyze_pos_t raw;
   const float theta_per_segment = angular_travel / segments,
-              linear_per_segment = linear_travel / segments,
-              extruder_per_segment = extruder_travel / segments,
-              sq_theta_per_segment = sq(theta_per_segment),
-              sin_T = theta_per_segment - sq_theta_per_segment*theta_per_segment/6,
-              cos_T = 1 - 0.5f * sq_theta_per_segment; // Small angle approximation
+              sq_theta_per_segment = sq(theta_per_segment);
+
+  arc.rvec = rvec;
+  arc.target = cart;
+  arc.center_P = center_P;
+  arc.center_Q = center_Q;
+  arc.start_L = start_L;
+  arc.theta_per_segment = theta_per_segment;
+  arc.linear_per_segment = linear_travel / segments;
+  arc.extruder_per_segment = extruder_travel / segments;
+  arc.sin_T = theta_per_segment - sq_theta_per_segment * theta_per_segment / 6;
+  arc.cos_T = 1 - 0.5f * sq_theta_per_segment; // Small angle approximation
+  arc.segments = segments;
+  arc.index = 1;
+  #if N_ARC_CORRECTION > 1
+    arc.recalc_count = N_ARC_CORRECTION;
+  #endif
+  TERN_(SCARA_FEEDRATE_SCALING, arc.inv_duration = arc.scaled_fr_mm_s / seg_length);
+  #if ENABLED(ARC_BLOCKS)
+    arc.radius = radius;
+    arc.angular_travel = angular_travel;
+    arc.mm_of_travel = mm_of_travel;
+  #endif
+
+  return true;
+}
 
-  // Initialize the linear axis
-  raw[l_axis] = current_position[l_axis];
+#if ENABLED(ARC_P_CIRCLES)
+  // Set up the next full circle, or the end of the arc. False if there's nothing left to do.
+  static bool next_sweep() {
+    while (arc.circles >= 0)
+      if (start_sweep(arc.circles-- ? arc.raw : arc.cart, arc.clockwise)) return true;
+    return false;
+  }
+#endif
 
-  // Initialize the extruder axis
-  raw.e = current_position.e;
+// Buffer one segment of the arc at arc.raw
+static inline bool buffer_arc_segment() {
+  apply_motion_limits(arc.raw);
 
-  #if ENABLED(SCARA_FEEDRATE_SCALING)
-    const float inv_duration = scaled_fr_mm_s / seg_length;
+  #if HAS_LEVELING && !PLANNER_LEVELING
+    xyze_pos_t pos = arc.raw;
+    planner.apply_leveling(pos);
+  #else
+    const xyze_pos_t &pos = arc.raw;
   #endif
 
-  millis_t next_idle_ms = millis() + 200UL;
+  return planner.buffer_line(pos, arc.scaled_fr_mm_s, active_extruder, 0
+    #if ENABLED(SCARA_FEEDRATE_SCALING)
+      , arc.inv_duration
+    #endif
+  );
+}
 
-  #if N_ARC_CORRECTION > 1
-    int8_t arc_recalc_count = N_ARC_CORRECTION;
-  #endif
+#if ENABLED(ARC_BLOCKS)
 
-  for (uint16_t i = 1; i < segments; i++) { // Iterate (segments-1) times
+  // Buffer the whole sweep as a single arc block, if the planner can take it
+  static bool buffer_arc_block() {
+    if (p_axis != X_AXIS) return false;
 
-    thermalManager.manage_heater();
-    if (ELAPSED(millis(), next_idle_ms)) {
-      next_idle_ms = millis() + 200UL;
-      idle();
-    }
+    // Segments are clamped to the soft endstops, so stay well inside them
+    #if HAS_SOFTWARE_ENDSTOPS
+      if (soft_endstops_enabled && !(
+           WITHIN(arc.center_P - arc.radius, soft_endstop.min.x, soft_endstop.max.x)
+        && WITHIN(arc.center_P + arc.radius, soft_endstop.min.x, soft_endstop.max.x)
+        && WITHIN(arc.center_Q - arc.radius, soft_endstop.min.y, soft_endstop.max.y)
+        && WITHIN(arc.center_Q + arc.radius, soft_endstop.min.y, soft_endstop.max.y)
+      )) return false;
+    #endif
+
+    xyze_pos_t end = arc.target;
+    TERN_(AUTO_BED_LEVELING_UBL, end[l_axis] = arc.start_L);
+    apply_motion_limits(end);
 
-    #if N_ARC_CORRECTION > 1
-      if (--arc_recalc_count) {
-        // Apply vector rotation matrix to previous rvec.a / 1
-        const float r_new_Y = rvec.a * sin_T + rvec.b * cos_T;
-        rvec.a = rvec.a * cos_T - rvec.b * sin_T;
-        rvec.b = r_new_Y;
+    return planner.buffer_arc(end, { arc.center_P, arc.center_Q }, arc.angular_travel, arc.mm_of_travel, arc.scaled_fr_mm_s, active_extruder);
+  }
+
+#endif
+
+/**
+ * Buffer arc segments while the planner has room.
+ * Return false when the arc is done.
+ */
+static bool arc_segments() {
+  while (planner.moves_free()) {
+
+    #if ENABLED(ARC_BLOCKS)
+      // Step the whole sweep in one block, or fall back to segments
+      if (arc.index == 1 && buffer_arc_block()) {
+        arc.raw = arc.target;
+        TERN_(AUTO_BED_LEVELING_UBL, arc.raw[l_axis] = arc.start_L);
+        if (TERN0(ARC_P_CIRCLES, next_sweep())) continue;
+        return false;
       }
-      else
     #endif
-    {
+
+    if (arc.index < arc.segments) {         // Iterate (segments-1) times
+
       #if N_ARC_CORRECTION > 1
-        arc_recalc_count = N_ARC_CORRECTION;
+        if (--arc.recalc_count) {
+          // Apply vector rotation matrix to previous rvec.a / 1
+          const float r_new_Y = arc.rvec.a * arc.sin_T + arc.rvec.b * arc.cos_T;
+          arc.rvec.a = arc.rvec.a * arc.cos_T - arc.rvec.b * arc.sin_T;
+          arc.rvec.b = r_new_Y;
+        }
+        else
       #endif
+      {
+        #if N_ARC_CORRECTION > 1
+          arc.recalc_count = N_ARC_CORRECTION;
+        #endif
+
+        // Arc correction to radius vector. Computed only every N_ARC_CORRECTION increments.
+        // Compute exact location by applying transformation matrix from initial radius vector(=-offset).
+        // To reduce stuttering, the sin and cos could be computed at different times.
+        // For now, compute both at the same time.
+        const float cos_Ti = cos(arc.index * arc.theta_per_segment), sin_Ti = sin(arc.index * arc.theta_per_segment);
+        arc.rvec.a = -arc.offset[0] * cos_Ti + arc.offset[1] * sin_Ti;
+        arc.rvec.b = -arc.offset[0] * sin_Ti - arc.offset[1] * cos_Ti;
+      }
 
-      // Arc correction to radius vector. Computed only every N_ARC_CORRECTION increments.
-      // Compute exact location by applying transformation matrix from initial radius vector(=-offset).
-      // To reduce stuttering, the sin and cos could be computed at different times.
-      // For now, compute both at the same time.
-      const float cos_Ti = cos(i * theta_per_segment), sin_Ti = sin(i * theta_per_segment);
-      rvec.a = -offset[0] * cos_Ti + offset[1] * sin_Ti;
-      rvec.b = -offset[0] * sin_Ti - offset[1] * cos_Ti;
-    }
-
-    // Update raw location
-    raw[p_axis] = center_P + rvec.a;
-    raw[q_axis] = center_Q + rvec.b;
-    #if ENABLED(AUTO_BED_LEVELING_UBL)
-      raw[l_axis] = start_L;
-      UNUSED(linear_per_segment);
-    #else
-      raw[l_axis] += linear_per_segment;
-    #endif
-    raw.e += extruder_per_segment;
+      // Update raw location
+      arc.raw[p_axis] = arc.center_P + arc.rvec.a;
+      arc.raw[q_axis] = arc.center_Q + arc.rvec.b;
+      #if ENABLED(AUTO_BED_LEVELING_UBL)
+        arc.raw[l_axis] = arc.start_L;
+      #else
+        arc.raw[l_axis] += arc.linear_per_segment;
+      #endif
+      arc.raw.e += arc.extruder_per_segment;
 
-    apply_motion_limits(raw);
+      arc.index++;
+      if (!buffer_arc_segment()) return false;
+    }
+    else {
+      // Ensure last segment arrives at target location.
+      arc.raw = arc.target;
+      TERN_(AUTO_BED_LEVELING_UBL, arc.raw[l_axis] = arc.start_L);
+      if (!buffer_arc_segment()) return false;
 
-    #if HAS_LEVELING && !PLANNER_LEVELING
-      planner.apply_leveling(raw);
-    #endif
+      // Go around again, or on to the end of the arc
+      if (TERN0(ARC_P_CIRCLES, next_sweep())) continue;
 
-    if (!planner.buffer_line(raw, scaled_fr_mm_s, active_extruder, 0
-      #if ENABLED(SCARA_FEEDRATE_SCALING)
-        , inv_duration
-      #endif
-    )) break;
+      return false;
+    }
   }
+  return true;
+}
 
-  // Ensure last segment arrives at target location.
-  raw = cart;
-  TERN_(AUTO_BED_LEVELING_UBL, raw[l_axis] = start_L);
+/**
+ * Plan an arc in 2 dimensions, after 'circles' complete circles,
+ * and start buffering its segments. current_position is set to the
+ * end of the arc and planner.segment_generator buffers the rest.
+ */
+void plan_arc(
+  const xyze_pos_t &cart,   // Destination position
+  const ab_float_t &offset, // Center of rotation relative to current_position
+  const uint8_t clockwise   // Clockwise?
+  #if ENABLED(ARC_P_CIRCLES)
+    , const int8_t circles/*=0*/
+  #endif
+) {
+  #if ENABLED(CNC_WORKSPACE_PLANES)
+    switch (gcode.workspace_plane) {
+      default:
+      case GcodeSuite::PLANE_XY: p_axis = X_AXIS; q_axis = Y_AXIS; l_axis = Z_AXIS; break;
+      case GcodeSuite::PLANE_YZ: p_axis = Y_AXIS; q_axis = Z_AXIS; l_axis = X_AXIS; break;
+      case GcodeSuite::PLANE_ZX: p_axis = Z_AXIS; q_axis = X_AXIS; l_axis = Y_AXIS; break;
+    }
+  #endif
 
-  apply_motion_limits(raw);
+  arc.raw = current_position;
+  arc.offset = offset;
+  arc.scaled_fr_mm_s = MMS_SCALED(feedrate_mm_s);
 
-  #if HAS_LEVELING && !PLANNER_LEVELING
-    planner.apply_leveling(raw);
+  #if ENABLED(ARC_P_CIRCLES)
+    arc.cart = cart;
+    arc.circles = circles;
+    arc.clockwise = clockwise;
+    if (!next_sweep()) return;
+  #else
+    if (!start_sweep(cart, clockwise)) return;
   #endif
 
-  planner.buffer_line(raw, scaled_fr_mm_s, active_extruder, 0
-    #if ENABLED(SCARA_FEEDRATE_SCALING)
-      , inv_duration
-    #endif
-  );
+  // The arc will end at the target
+  current_position = cart;
+  TERN_(AUTO_BED_LEVELING_UBL, current_position[l_axis] = arc.start_L);
+  apply_motion_limits(current_position);
 
-  TERN_(AUTO_BED_LEVELING_UBL, raw[l_axis] = start_L);
-  current_position = raw;
+  planner.start_segments(arc_segments);
 
 } // plan_arc
 
@@ -323,15 +444,18 @@ void GcodeSuite::G2_G3(const bool clockwise) {
       #if ENABLED(ARC_P_CIRCLES)
         // P indicates number of circles to do
         int8_t circles_to_do = parser.byteval('P');
-        if (!WITHIN(circles_to_do, 0, 100))
+        if (!WITHIN(circles_to_do, 0, 100)) {
           SERIAL_ERROR_MSG(STR_ERR_ARC_ARGS);
-
-        while (circles_to_do--)
-          plan_arc(current_position, arc_offset, clockwise);
+          circles_to_do = 0;
+        }
       #endif
 
       // Send the arc to the planner
-      plan_arc(destination, arc_offset, clockwise);
+      plan_arc(destination, arc_offset, clockwise
+        #if ENABLED(ARC_P_CIRCLES)
+          , circles_to_do
+        #endif
+      );
       reset_stepper_timeout();
     }
     else
@@ -32,6 +32,10 @@
   #include "queue.h"
 #endif
 
+#if ENABLED(BINARY_GCODE)
+  #include "binary_gcode.h"
+#endif
+
 // Must be declared for allocation and to satisfy the linker
 // Zero values need no initialization.
 
@@ -66,6 +70,13 @@ int GCodeParser::codenum;
   // Optimized Parameters
   uint32_t GCodeParser::codebits;  // found bits
   uint8_t GCodeParser::param[26];  // parameter offsets from command_ptr
+  #if ENABLED(GCODE_VALUE_CACHE)
+    float GCodeParser::param_value[26];
+    uint8_t GCodeParser::value_ind;
+  #endif
+  #if ENABLED(BINARY_GCODE)
+    bool GCodeParser::from_binary;
+  #endif
 #else
   char *GCodeParser::command_args; // start of parameters
 #endif
@@ -86,10 +97,62 @@ void GCodeParser::reset() {
   TERN_(USE_GCODE_SUBCODES, subcode = 0); // No command sub-code
   #if ENABLED(FASTER_GCODE_PARSER)
     codebits = 0;                       // No codes yet
+    TERN_(BINARY_GCODE, from_binary = false); // Values are in the command
     //ZERO(param);                      // No parameters (should be safe to comment out this line)
   #endif
 }
 
+/**
+ * Convert a decimal value without strtof, leaving the buffer untouched.
+ *
+ * Digits are gathered into an integer and divided once by a power of ten.
+ * Both are exact floats up to 2^24 and 10^10, and the division rounds
+ * correctly, so the result is the same as strtof for anything a slicer
+ * sends (e.g., "-123.45678"). Longer values fall back to strtof on a copy.
+ */
+float GCodeParser::parse_float(const char *p) {
+  static const float pow10[] PROGMEM = { 1e0f, 1e1f, 1e2f, 1e3f, 1e4f, 1e5f, 1e6f, 1e7f, 1e8f, 1e9f, 1e10f };
+
+  const char * const start = p;
+  const bool neg = (*p == '-');
+  if (neg || *p == '+') p++;
+
+  uint32_t digits = 0;
+  uint8_t decimals = 0;
+  bool point = false, exact = true;
+  for (;; p++) {
+    const char c = *p;
+    if (NUMERIC(c)) {
+      if (digits > 0x0FFFFFFFUL) { exact = false; continue; }
+      digits = digits * 10 + (c - '0');
+      if (point) decimals++;
+    }
+    else if (c == '.' && !point)
+      point = true;
+    else
+      break;
+  }
+
+  if (!exact || digits > _BV32(24) || decimals >= COUNT(pow10)) {
+    char buffer[24];
+    const uint8_t len = _MIN(p - start, int(sizeof(buffer) - 1));
+    memcpy(buffer, start, len);
+    buffer[len] = '\0';
+    return strtof(buffer, nullptr);
+  }
+
+  const float value = decimals ? float(digits) / pgm_read_float(&pow10[decimals]) : float(digits);
+  return neg ? -value : value;
+}
+
+int32_t GCodeParser::parse_long(const char *p) {
+  const bool neg = (*p == '-');
+  if (neg || *p == '+') p++;
+  uint32_t value = 0;
+  for (; NUMERIC(*p); p++) value = value * 10 + (*p - '0');
+  return int32_t(neg ? 0 - value : value);
+}
+
 #if ENABLED(GCODE_QUOTED_STRINGS)
 
   // Pass the address after the first quote (if any)
@@ -114,6 +177,10 @@ void GCodeParser::reset() {
 // 58 bytes of SRAM are used to speed up seen/value
 void GCodeParser::parse(char *p) {
 
+  #if ENABLED(BINARY_GCODE)
+    if (BinaryGCode::is_command(p)) return parse_binary(p);
+  #endif
+
   reset(); // No codes to report
 
   auto uppercase = [](char c) {
@@ -340,6 +407,59 @@ void GCodeParser::parse(char *p) {
   }
 }
 
+#if ENABLED(BINARY_GCODE)
+
+  /**
+   * Load a binary command straight into the parameter table. The values
+   * go into param_value, so the parameter offsets only have to be non-zero
+   * and command_ptr is kept on the command so it can be parsed again.
+   */
+  void GCodeParser::parse_binary(char * const cmd) {
+    reset();
+    from_binary = true;
+    command_ptr = cmd;
+
+    const uint8_t *p = (uint8_t*)cmd;
+    const uint8_t type = *p++;
+    const uint8_t letter = (type >> BGC_LETTER_SHIFT) & 0x3;
+    if (letter > 2) return;
+
+    codenum = *p++;
+    if (type & BGC_CODE16) codenum |= uint16_t(*p++) << 8;
+    if (type & BGC_SUBCODE) { TERN_(USE_GCODE_SUBCODES, subcode = *p); p++; }
+    command_letter = letter == 0 ? 'G' : letter == 1 ? 'M' : 'T';
+
+    #if ENABLED(GCODE_MOTION_MODES)
+      if (letter == 0 && (codenum <= GTOP || codenum == 5 || TERN0(G38_PROBE_TARGET, codenum == 38))) {
+        motion_mode_codenum = codenum;
+        TERN_(USE_GCODE_SUBCODES, motion_mode_subcode = subcode);
+      }
+    #endif
+
+    uint32_t values, novalue = 0;
+    memcpy(&values, p, sizeof(values)); p += sizeof(values);
+    if (type & BGC_NOVALUE) { memcpy(&novalue, p, sizeof(novalue)); p += sizeof(novalue); }
+    codebits = (values | novalue) & (_BV32(COUNT(param)) - 1);
+
+    LOOP_L_N(i, COUNT(param)) {
+      if (TEST32(values, i)) {
+        if (type & BGC_FIXED) {
+          int32_t fixed;
+          memcpy(&fixed, p, sizeof(fixed));
+          param_value[i] = fixed / float(BGC_FIXED_SCALE);
+        }
+        else
+          memcpy(&param_value[i], p, sizeof(float));
+        p += 4;
+        param[i] = 1;
+      }
+      else
+        param[i] = 0;
+    }
+  }
+
+#endif // BINARY_GCODE
+
 #if ENABLED(CNC_COORDINATE_SYSTEMS)
 
   // Parse the next parameter as a new command
@@ -361,6 +481,16 @@ void GCodeParser::parse(char *p) {
 #endif // CNC_COORDINATE_SYSTEMS
 
 void GCodeParser::unknown_command_warning() {
+  #if ENABLED(BINARY_GCODE)
+    if (from_binary) {
+      SERIAL_ECHO_START();
+      SERIAL_ECHOPGM(STR_UNKNOWN_COMMAND);
+      SERIAL_CHAR(command_letter);
+      SERIAL_ECHO(codenum);
+      SERIAL_ECHOLNPGM("\"");
+      return;
+    }
+  #endif
   SERIAL_ECHO_MSG(STR_UNKNOWN_COMMAND, command_ptr, "\"");
 }
 
@@ -62,6 +62,13 @@ private:
   #if ENABLED(FASTER_GCODE_PARSER)
     static uint32_t codebits;       // Parameters pre-scanned
     static uint8_t param[26];       // For A-Z, offsets into command args
+    #if ENABLED(GCODE_VALUE_CACHE)
+      static float param_value[26]; // For A-Z, values converted by parse()
+      static uint8_t value_ind;     // Set by seen, the parameter value_ptr points to
+    #endif
+    #if ENABLED(BINARY_GCODE)
+      static bool from_binary;      // Values are only in param_value
+    #endif
   #else
     static char *command_args;      // Args start here, for slow scan
   #endif
@@ -126,6 +133,9 @@ public:
       if (ind >= COUNT(param)) return;           // Only A-Z
       SBI32(codebits, ind);                      // parameter exists
       param[ind] = ptr ? ptr - command_ptr : 0;  // parameter offset or 0
+      #if ENABLED(GCODE_VALUE_CACHE)
+        if (ptr) param_value[ind] = parse_float(ptr);
+      #endif
       #if ENABLED(DEBUG_GCODE_PARSER)
         if (codenum == 800) {
           SERIAL_ECHOPAIR("Set bit ", (int)ind, " of codebits (", hex_address((void*)(codebits >> 16)));
@@ -143,7 +153,8 @@ public:
       const bool b = TEST32(codebits, ind);
       if (b) {
         char * const ptr = command_ptr + param[ind];
-        value_ptr = param[ind] && valid_float(ptr) ? ptr : nullptr;
+        value_ptr = param[ind] && (TERN0(BINARY_GCODE, from_binary) || valid_float(ptr)) ? ptr : nullptr;
+        TERN_(GCODE_VALUE_CACHE, value_ind = ind);
       }
       return b;
     }
@@ -230,6 +241,11 @@ public:
   // This uses 54 bytes of SRAM to speed up seen/value
   static void parse(char * p);
 
+  #if ENABLED(BINARY_GCODE)
+    // Populate all fields from a binary command (See binary_gcode.h)
+    static void parse_binary(char * const p);
+  #endif
+
   #if ENABLED(CNC_COORDINATE_SYSTEMS)
     // Parse the next parameter as a new command
     static bool chain();
@@ -244,29 +260,26 @@ public:
   // The value as a string
   static inline char* value_string() { return value_ptr; }
 
-  // Float removes 'E' to prevent scientific notation interpretation
+  // Convert [-+]?[0-9]*.?[0-9]* in one pass. Stops at 'E', so there's no scientific notation.
+  static float parse_float(const char *p);
+
+  // Convert [-+]?[0-9]* in one pass. Values above INT32_MAX wrap, so they cast back to uint32_t.
+  static int32_t parse_long(const char *p);
+
   static inline float value_float() {
-    if (value_ptr) {
-      char *e = value_ptr;
-      for (;;) {
-        const char c = *e;
-        if (c == '\0' || c == ' ') break;
-        if (c == 'E' || c == 'e') {
-          *e = '\0';
-          const float ret = strtof(value_ptr, nullptr);
-          *e = c;
-          return ret;
-        }
-        ++e;
-      }
-      return strtof(value_ptr, nullptr);
-    }
-    return 0;
+    #if ENABLED(GCODE_VALUE_CACHE)
+      return value_ptr ? param_value[value_ind] : 0;
+    #else
+      return value_ptr ? parse_float(value_ptr) : 0;
+    #endif
   }
 
   // Code value as a long or ulong
-  static inline int32_t value_long() { return value_ptr ? strtol(value_ptr, nullptr, 10) : 0L; }
-  static inline uint32_t value_ulong() { return value_ptr ? strtoul(value_ptr, nullptr, 10) : 0UL; }
+  static inline int32_t value_long() {
+    TERN_(BINARY_GCODE, if (from_binary) return value_ptr ? int32_t(param_value[value_ind]) : 0L);
+    return value_ptr ? parse_long(value_ptr) : 0L;
+  }
+  static inline uint32_t value_ulong() { return (uint32_t)value_long(); }
 
   // Code value for use as time
   static inline millis_t value_millis() { return value_ulong(); }
@@ -43,10 +43,18 @@ GCodeQueue queue;
   #include "../feature/binary_protocol.h"
 #endif
 
+#if ENABLED(BINARY_GCODE)
+  #include "binary_gcode.h"
+#endif
+
 #if ENABLED(POWER_LOSS_RECOVERY)
   #include "../feature/powerloss.h"
 #endif
 
+#if ENABLED(CANCEL_OBJECTS_INDEX)
+  #include "../feature/object_index.h"
+#endif
+
 /**
  * GCode line number handling. Hosts may opt to include line numbers when
  * sending commands to Marlin, and lines will be checked for sequentiality.
@@ -150,6 +158,29 @@ bool GCodeQueue::_enqueue(const char* cmd, bool say_ok/*=false*/
   return true;
 }
 
+#if ENABLED(BINARY_GCODE)
+
+  /**
+   * Copy a command from a binary packet into the main command buffer.
+   * The packet was acknowledged, so the command gets no "ok".
+   */
+  bool GCodeQueue::enqueue_binary(const char * const cmd, const uint8_t size
+    #if HAS_MULTI_SERIAL
+      , int16_t pn/*=-1*/
+    #endif
+  ) {
+    if (length >= BUFSIZE || size > MAX_CMD_SIZE) return false;
+    memcpy(command_buffer[index_w], cmd, size);
+    _commit_command(false
+      #if HAS_MULTI_SERIAL
+        , pn
+      #endif
+    );
+    return true;
+  }
+
+#endif
+
 #define ISEOL(C) ((C) == '\n' || (C) == '\r')
 
 /**
@@ -272,6 +303,8 @@ void GCodeQueue::enqueue_now_P(PGM_P const pgcode) {
  *   N<int>  Line number of the command, if any
  *   P<int>  Planner space remaining
  *   B<int>  Block queue space remaining
+ *
+ * With an M576 window the "ok" may be held back to cover more lines.
  */
 void GCodeQueue::ok_to_send() {
   #if HAS_MULTI_SERIAL
@@ -280,6 +313,15 @@ void GCodeQueue::ok_to_send() {
     PORT_REDIRECT(pn);                    // Reply to the serial port that sent the command
   #endif
   if (!send_ok[index_r]) return;
+  #if ENABLED(SERIAL_WINDOW_ACK)
+    const uint8_t wp = command_port();
+    if (ack_window[wp]) {
+      const char * const cmd = command_buffer[index_r];
+      if (*cmd == 'N') ack_N[wp] = GCodeParser::parse_long(cmd + 1);
+      if (++ack_pending[wp] >= (ack_window[wp] + 1) / 2 || !lines_queued(wp)) flush_ack(wp);
+      return;
+    }
+  #endif
   SERIAL_ECHOPGM(STR_OK);
   #if ENABLED(ADVANCED_OK)
     char* p = command_buffer[index_r];
@@ -306,11 +348,53 @@ void GCodeQueue::flush_and_request_resend() {
     PORT_REDIRECT(pn);                    // Reply to the serial port that sent the command
   #endif
   SERIAL_FLUSH();
+  #if ENABLED(SERIAL_WINDOW_ACK)
+    // Acknowledge what ran, so the host knows where to resume. No "ok" follows.
+    if (ack_window[pn]) {
+      flush_ack(pn);
+      SERIAL_ECHOPGM(STR_RESEND);
+      SERIAL_ECHOLN(last_N[pn] + 1);
+      return;
+    }
+  #endif
   SERIAL_ECHOPGM(STR_RESEND);
   SERIAL_ECHOLN(last_N[pn] + 1);
   ok_to_send();
 }
 
+#if ENABLED(SERIAL_WINDOW_ACK)
+
+  uint8_t GCodeQueue::ack_window[NUM_SERIAL], GCodeQueue::ack_pending[NUM_SERIAL];
+  long GCodeQueue::ack_N[NUM_SERIAL];
+
+  // Is a line from the given port queued behind the current command?
+  bool GCodeQueue::lines_queued(const uint8_t pn) {
+    for (uint8_t i = 1, r = index_r; i < length; i++) {
+      if (++r >= BUFSIZE) r = 0;
+      if (send_ok[r] && TERN1(HAS_MULTI_SERIAL, port[r] == pn)) return true;
+    }
+    return false;
+  }
+
+  void GCodeQueue::flush_ack(const uint8_t pn) {
+    if (!ack_pending[pn]) return;
+    ack_pending[pn] = 0;
+    PORT_REDIRECT(pn);
+    SERIAL_ECHOPGM(STR_OK);
+    SERIAL_ECHOPAIR(" N", ack_N[pn]);
+    SERIAL_ECHOPAIR_P(SP_P_STR, int(planner.moves_free()),
+                      SP_B_STR, int(BUFSIZE - length));
+    SERIAL_EOL();
+  }
+
+  void GCodeQueue::set_ack_window(const uint8_t pn, const uint8_t lines) {
+    flush_ack(pn);
+    ack_window[pn] = _MIN(lines, BUFSIZE);
+    ack_N[pn] = last_N[pn];
+  }
+
+#endif
+
 inline bool serial_data_available() {
   return MYSERIAL0.available() || TERN0(HAS_MULTI_SERIAL, MYSERIAL1.available());
 }
@@ -474,7 +558,7 @@ void GCodeQueue::get_serial_commands() {
             if (n2pos) npos = n2pos;
           }
 
-          const long gcode_N = strtol(npos + 1, nullptr, 10);
+          const long gcode_N = GCodeParser::parse_long(npos + 1);
 
           if (gcode_N != last_N[i] + 1 && !M110)
             return gcode_line_error(PSTR(STR_ERR_LINE_NO), i);
@@ -483,7 +567,7 @@ void GCodeQueue::get_serial_commands() {
           if (apos) {
             uint8_t checksum = 0, count = uint8_t(apos - command);
             while (count) checksum ^= command[--count];
-            if (strtol(apos + 1, nullptr, 10) != checksum)
+            if (GCodeParser::parse_long(apos + 1) != checksum)
               return gcode_line_error(PSTR(STR_ERR_CHECKSUM_MISMATCH), i);
           }
           else
@@ -550,6 +634,34 @@ void GCodeQueue::get_serial_commands() {
 
 #if ENABLED(SDSUPPORT)
 
+  #if ENABLED(BINARY_GCODE)
+
+    /**
+     * Read the rest of a binary command from the SD card, given its
+     * first byte. A command too big for the buffer is read and dropped.
+     */
+    inline bool get_sdcard_binary(const uint8_t type, char (&buff)[MAX_CMD_SIZE]) {
+      uint8_t * const cmd = (uint8_t*)buff;
+      const uint8_t head = BinaryGCode::header_size(type);
+      cmd[0] = type;
+      for (uint8_t i = 1; i < head; i++) {
+        const int16_t n = card.get();
+        if (n < 0) return false;
+        cmd[i] = n;
+      }
+      const uint8_t size = BinaryGCode::size(cmd);
+      for (uint8_t i = head; i < size; i++) {
+        const int16_t n = card.get();
+        if (n < 0) return false;
+        if (i < MAX_CMD_SIZE) cmd[i] = n;
+      }
+      if (size <= MAX_CMD_SIZE) return true;
+      SERIAL_ERROR_MSG("Binary command too long");
+      return false;
+    }
+
+  #endif
+
   /**
    * Get lines from the SD Card until the command buffer is full
    * or until the end of the file is reached. Because this method
@@ -561,13 +673,38 @@ void GCodeQueue::get_serial_commands() {
 
     if (!IS_SD_PRINTING()) return;
 
+    TERN_(CANCEL_OBJECTS_INDEX, object_index.scan());
+
     int sd_count = 0;
     bool card_eof = card.eof();
     while (length < BUFSIZE && !card_eof) {
+      #if ENABLED(CANCEL_OBJECTS_INDEX)
+        // Restore the state left by a skipped object before reading on
+        if (!sd_count && object_index.next_command(command_buffer[index_w])) {
+          _commit_command(false);
+          continue;
+        }
+      #endif
+
       const int16_t n = card.get();
       card_eof = card.eof();
       if (n < 0 && !card_eof) { SERIAL_ERROR_MSG(STR_SD_ERR_READ); continue; }
 
+      #if ENABLED(BINARY_GCODE)
+        // A binary command can take the place of a line
+        if (!sd_count && sd_input_state == PS_NORMAL && n > 0 && TEST(n, 7)) {
+          if (get_sdcard_binary(n, command_buffer[index_w])) {
+            _commit_command(false);
+            #if ENABLED(POWER_LOSS_RECOVERY)
+              recovery.cmd_sdpos = card.getIndex() + 1; // The NEXT command starts right after this one
+            #endif
+          }
+          else if ((card_eof = card.eof()))
+            card.fileHasFinished();                     // The file ended inside the command
+          continue;
+        }
+      #endif
+
       const char sd_char = (char)n;
       const bool is_eol = ISEOL(sd_char);
       if (is_eol || card_eof) {
@@ -575,6 +712,7 @@ void GCodeQueue::get_serial_commands() {
         // Reset stream state, terminate the buffer, and commit a non-empty command
         if (!is_eol && sd_count) ++sd_count;          // End of file with no newline
         if (!process_line_done(sd_input_state, command_buffer[index_w], sd_count)) {
+          TERN_(CANCEL_OBJECTS_INDEX, object_index.line_read(command_buffer[index_w]));
           _commit_command(false);
           #if ENABLED(POWER_LOSS_RECOVERY)
             recovery.cmd_sdpos = card.getIndex();     // Prime for the NEXT _commit_command
@@ -609,6 +747,9 @@ void GCodeQueue::get_available_commands() {
  */
 void GCodeQueue::advance() {
 
+  // Commands wait for a curve to be fully buffered
+  if (TERN0(HAS_SEGMENT_GENERATOR, planner.run_segment_generator())) return;
+
   // Process immediate commands
   if (process_injected_command_P() || process_injected_command()) return;
 
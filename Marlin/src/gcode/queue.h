@@ -112,6 +112,19 @@ public:
    */
   static void enqueue_now_P(PGM_P const cmd);
 
+  #if ENABLED(BINARY_GCODE)
+    /**
+     * Copy a binary command (See binary_gcode.h) or a nul-terminated
+     * line of the given size into the queue, with no "ok" to follow.
+     * Return false for a full buffer.
+     */
+    static bool enqueue_binary(const char * const cmd, const uint8_t size
+      #if HAS_MULTI_SERIAL
+        , int16_t pn=-1
+      #endif
+    );
+  #endif
+
   /**
    * Check whether there are any commands yet to be executed
    */
@@ -147,6 +160,22 @@ public:
    */
   static void flush_and_request_resend();
 
+  #if ENABLED(SERIAL_WINDOW_ACK)
+    /**
+     * Windowed flow control (M576). The host may send up to 'window'
+     * lines ahead, and lines are acknowledged together by one "ok N..."
+     * once half the window has run, or when no more lines are queued.
+     */
+    static uint8_t ack_window[NUM_SERIAL],  // Lines the host may send ahead. 0 for an "ok" per line.
+                   ack_pending[NUM_SERIAL]; // Lines run since the last "ok"
+    static long ack_N[NUM_SERIAL];          // The last line number run
+
+    static void set_ack_window(const uint8_t pn, const uint8_t lines);
+
+    // Acknowledge all lines run so far
+    static void flush_ack(const uint8_t pn);
+  #endif
+
 private:
 
   static uint8_t index_w;  // Ring buffer write position
@@ -183,6 +212,8 @@ private:
 
   static void gcode_line_error(PGM_P const err, const int8_t pn);
 
+  TERN_(SERIAL_WINDOW_ACK, static bool lines_queued(const uint8_t pn));
+
 };
 
 extern GCodeQueue queue;
@@ -348,6 +348,9 @@
   #define _SDCARD_CUSTOM_CABLE 3
   #define _SDCARD_ID(V) _CAT(_SDCARD_, V)
   #define SD_CONNECTION_IS(V) (_SDCARD_ID(SDCARD_CONNECTION) == _SDCARD_ID(V))
+  #if SD_READ_AHEAD_BLOCKS
+    #define HAS_SD_READ_AHEAD 1
+  #endif
 #else
   #define SD_CONNECTION_IS(...) 0
 #endif
@@ -367,3 +370,8 @@
 #if ENABLED(EEPROM_SETTINGS) && NONE(I2C_EEPROM, SPI_EEPROM, QSPI_EEPROM, FLASH_EEPROM_EMULATION, SRAM_EEPROM_EMULATION, SDCARD_EEPROM_EMULATION)
   #define NO_EEPROM_SELECTED 1
 #endif
+
+// Curves fed to the planner a few segments at a time
+#if EITHER(ARC_SUPPORT, BEZIER_CURVE_SUPPORT)
+  #define HAS_SEGMENT_GENERATOR 1
+#endif
@@ -740,6 +740,28 @@ static_assert(Y_MAX_LENGTH >= Y_BED_SIZE, "Movement bounds (Y_MIN_POS, Y_MAX_POS
   #endif
 #endif
 
+#if ENABLED(PRINT_TIME_ESTIMATE) && DISABLED(SDSUPPORT)
+  #error "PRINT_TIME_ESTIMATE requires SDSUPPORT."
+#endif
+
+#if ENABLED(CANCEL_OBJECTS_INDEX)
+  #if DISABLED(SDSUPPORT)
+    #error "CANCEL_OBJECTS_INDEX requires SDSUPPORT."
+  #elif !WITHIN(CANCEL_OBJECTS_INDEX_SIZE, 2, 255)
+    #error "CANCEL_OBJECTS_INDEX_SIZE must be from 2 to 255."
+  #endif
+#endif
+
+#if ENABLED(SDCARD_DIR_INDEX)
+  #if !WITHIN(SDCARD_DIR_INDEX_LIMIT, 10, 4096)
+    #error "SDCARD_DIR_INDEX_LIMIT must be from 10 to 4096."
+  #elif !WITHIN(SDCARD_DIR_INDEX_KEY, 4, 64)
+    #error "SDCARD_DIR_INDEX_KEY must be from 4 to 64."
+  #elif ANY(SDSORT_USES_RAM, SDSORT_CACHE_NAMES, SDSORT_DYNAMIC_RAM)
+    #error "SDCARD_DIR_INDEX replaces SDSORT_USES_RAM, SDSORT_CACHE_NAMES, and SDSORT_DYNAMIC_RAM. Disable them."
+  #endif
+#endif
+
 #if defined(EVENT_GCODE_SD_STOP) && DISABLED(NOZZLE_PARK_FEATURE)
   static_assert(nullptr == strstr(EVENT_GCODE_SD_STOP, "G27"), "NOZZLE_PARK_FEATURE is required to use G27 in EVENT_GCODE_SD_STOP.");
 #endif
@@ -1444,6 +1466,26 @@ static_assert(Y_MAX_LENGTH >= Y_BED_SIZE, "Movement bounds (Y_MIN_POS, Y_MAX_POS
   #error "MESH_EDIT_GFX_OVERLAY requires AUTO_BED_LEVELING_UBL and a Graphical LCD."
 #endif
 
+#if ENABLED(MESH_CELL_CACHE) && NONE(AUTO_BED_LEVELING_BILINEAR, AUTO_BED_LEVELING_UBL)
+  #error "MESH_CELL_CACHE requires AUTO_BED_LEVELING_BILINEAR or AUTO_BED_LEVELING_UBL."
+#endif
+
+#if ENABLED(MESH_BICUBIC)
+  #if DISABLED(MESH_CELL_CACHE)
+    #error "MESH_BICUBIC requires MESH_CELL_CACHE."
+  #elif ENABLED(ABL_BILINEAR_SUBDIVISION)
+    #error "MESH_BICUBIC replaces ABL_BILINEAR_SUBDIVISION. Disable one of them."
+  #endif
+#endif
+
+#if ENABLED(PROBE_ROUTE)
+  #if !HAS_BED_PROBE || NONE(AUTO_BED_LEVELING_LINEAR, AUTO_BED_LEVELING_BILINEAR, AUTO_BED_LEVELING_UBL)
+    #error "PROBE_ROUTE requires a probe and AUTO_BED_LEVELING_(LINEAR|BILINEAR|UBL)."
+  #elif GRID_MAX_POINTS > 255
+    #error "PROBE_ROUTE allows up to 255 GRID_MAX_POINTS."
+  #endif
+#endif
+
 #if ENABLED(G29_RETRY_AND_RECOVER)
   #if ENABLED(AUTO_BED_LEVELING_UBL)
     #error "G29_RETRY_AND_RECOVER is not compatible with UBL."
@@ -2685,6 +2727,14 @@ static_assert(   _ARR_TEST(3,0) && _ARR_TEST(3,1) && _ARR_TEST(3,2)
   #error "BACKUP_POWER_SUPPLY requires a POWER_LOSS_PIN."
 #endif
 
+#if ENABLED(POWER_LOSS_JOURNAL)
+  #if DISABLED(POWER_LOSS_RECOVERY)
+    #error "POWER_LOSS_JOURNAL requires POWER_LOSS_RECOVERY."
+  #elif !WITHIN(POWER_LOSS_JOURNAL_RECORDS, 1, 254)
+    #error "POWER_LOSS_JOURNAL_RECORDS must be from 1 to 254."
+  #endif
+#endif
+
 #if ENABLED(Z_STEPPER_AUTO_ALIGN)
   #if NUM_Z_STEPPER_DRIVERS <= 1
     #error "Z_STEPPER_AUTO_ALIGN requires NUM_Z_STEPPER_DRIVERS greater than 1."
@@ -3030,6 +3080,58 @@ static_assert(   _ARR_TEST(3,0) && _ARR_TEST(3,1) && _ARR_TEST(3,2)
   #error "MONITOR_DRIVER_STATUS and SDSUPPORT cannot be used together on boards with shared SPI."
 #endif
 
+// SD read-ahead, limited by the 16-bit file read size
+#if HAS_SD_READ_AHEAD && !WITHIN(SD_READ_AHEAD_BLOCKS, 2, 32)
+  #error "SD_READ_AHEAD_BLOCKS must be from 2 to 32."
+#endif
+
+// G-code parser value cache
+#if ENABLED(GCODE_VALUE_CACHE) && DISABLED(FASTER_GCODE_PARSER)
+  #error "GCODE_VALUE_CACHE requires FASTER_GCODE_PARSER."
+#elif ENABLED(BINARY_GCODE) && DISABLED(GCODE_VALUE_CACHE)
+  #error "BINARY_GCODE requires GCODE_VALUE_CACHE."
+#endif
+
+// Arc segment length
+#if ENABLED(ARC_SUPPORT) && defined(ARC_CHORD_TOLERANCE) && (defined(ARC_SEGMENTS_PER_R) || ARC_SEGMENTS_PER_SEC)
+  #error "ARC_CHORD_TOLERANCE can't be used with ARC_SEGMENTS_PER_R or ARC_SEGMENTS_PER_SEC."
+#endif
+
+#ifdef KINEMATIC_SEGMENT_TOLERANCE
+  #if !IS_KINEMATIC
+    #error "KINEMATIC_SEGMENT_TOLERANCE is only for DELTA and SCARA."
+  #elif !(KINEMATIC_SEGMENT_TOLERANCE > 0)
+    #error "KINEMATIC_SEGMENT_TOLERANCE must be greater than 0."
+  #endif
+#endif
+
+// Arc blocks are stepped in Cartesian XY
+#if ENABLED(ARC_BLOCKS)
+  #if DISABLED(ARC_SUPPORT)
+    #error "ARC_BLOCKS requires ARC_SUPPORT."
+  #elif defined(__AVR__)
+    #error "ARC_BLOCKS requires a 32-bit board."
+  #elif IS_KINEMATIC || IS_CORE
+    #error "ARC_BLOCKS is only for Cartesian machines."
+  #elif ENABLED(SKEW_CORRECTION)
+    #error "ARC_BLOCKS is not compatible with SKEW_CORRECTION."
+  #elif ENABLED(BACKLASH_COMPENSATION)
+    #error "ARC_BLOCKS is not compatible with BACKLASH_COMPENSATION."
+  #endif
+#endif
+
+#if ENABLED(INPUT_SHAPING)
+  #if IS_KINEMATIC || IS_CORE
+    #error "INPUT_SHAPING is only for Cartesian machines."
+  #elif ENABLED(I2S_STEPPER_STREAM)
+    #error "INPUT_SHAPING is not compatible with I2S_STEPPER_STREAM."
+  #elif !WITHIN(SHAPING_BUFFER_SIZE, 128, 32768) || (SHAPING_BUFFER_SIZE & (SHAPING_BUFFER_SIZE - 1))
+    #error "SHAPING_BUFFER_SIZE must be a power of 2 from 128 to 32768."
+  #endif
+  static_assert(SHAPING_FREQ_X >= 0 && SHAPING_FREQ_Y >= 0, "SHAPING_FREQ_[XY] must be 0 or more.");
+  static_assert(WITHIN(SHAPING_ZETA_X, 0, 0.99) && WITHIN(SHAPING_ZETA_Y, 0, 0.99), "SHAPING_ZETA_[XY] must be from 0.0 to 0.99.");
+#endif
+
 // G60/G61 Position Save
 #if SAVED_POSITIONS > 256
   #error "SAVED_POSITIONS must be an integer from 0 to 256."
@@ -61,6 +61,10 @@
   #include "../../module/probe.h"
 #endif
 
+#if ENABLED(PRINT_TIME_ESTIMATE)
+  #include "../../feature/time_estimate.h"
+#endif
+
 #include "../../libs/buzzer.h"
 
 #ifndef MACHINE_SIZE
@@ -4362,7 +4366,11 @@ void EachMomentUpdate(void) {
     static millis_t next_remain_time_update = 0;
     if (elapsed.minute() > 5 && ELAPSED(ms, next_remain_time_update) && HMI_flag.heat_flag == 0) { // show after 5 min and 20s update
       //remain_time = ((elapsed.value - dwin_heat_time) * ((float)card.getFileSize() / (float)card.getIndex())) - (elapsed.value - dwin_heat_time);
-      remain_time = (100-Percentrecord)* (elapsed.value - dwin_heat_time)/(Percentrecord);
+      #if ENABLED(PRINT_TIME_ESTIMATE)
+        remain_time = _MIN(time_estimate.remaining(), uint32_t(0xFFFF));
+      #else
+        remain_time = (100-Percentrecord)* (elapsed.value - dwin_heat_time)/(Percentrecord);
+      #endif
       next_remain_time_update += 20 * 1000UL;
       Draw_Print_ProgressRemain();
     }
@@ -100,6 +100,10 @@
   #include "../../feature/host_actions.h"
 #endif
 
+#if ENABLED(PRINT_TIME_ESTIMATE)
+  #include "../../feature/time_estimate.h"
+#endif
+
 namespace ExtUI {
   static struct {
     uint8_t printer_killed : 1;
@@ -817,6 +821,10 @@ namespace ExtUI {
     return elapsed.value;
   }
 
+  #if ENABLED(PRINT_TIME_ESTIMATE)
+    uint32_t getProgress_seconds_remaining() { return time_estimate.remaining(); }
+  #endif
+
   #if HAS_LEVELING
     bool getLevelingActive() { return planner.leveling_active; }
     void setLevelingActive(const bool state) { set_bed_leveling_enabled(state); }
@@ -828,6 +836,7 @@ namespace ExtUI {
         if (WITHIN(pos.x, 0, GRID_MAX_POINTS_X) && WITHIN(pos.y, 0, GRID_MAX_POINTS_Y)) {
           Z_VALUES(pos.x, pos.y) = zoff;
           TERN_(ABL_BILINEAR_SUBDIVISION, bed_level_virt_interpolate());
+          TERN_(MESH_CELL_CACHE, refresh_mesh_cells());
         }
       }
     #endif
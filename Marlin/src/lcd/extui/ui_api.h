@@ -131,6 +131,9 @@ namespace ExtUI {
   int16_t getFlowPercentage(const extruder_t);
   uint8_t getProgress_percent();
   uint32_t getProgress_seconds_elapsed();
+  #if ENABLED(PRINT_TIME_ESTIMATE)
+    uint32_t getProgress_seconds_remaining();
+  #endif
 
   #if HAS_LEVELING
     bool getLevelingActive();
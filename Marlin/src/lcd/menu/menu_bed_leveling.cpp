@@ -193,6 +193,7 @@
 #if ENABLED(MESH_EDIT_MENU)
 
   inline void refresh_planner() {
+    TERN_(MESH_CELL_CACHE, refresh_mesh_cells());
     set_current_from_steppers_for_axis(ALL_AXES);
     sync_plan_position();
   }
@@ -37,7 +37,7 @@
  */
 
 // Change EEPROM version if the structure changes
-#define EEPROM_VERSION "V82"
+#define EEPROM_VERSION "V83"
 #define EEPROM_OFFSET 100
 
 // Check the integrity of data offsets.
@@ -108,6 +108,10 @@
   #include "../feature/runout.h"
 #endif
 
+#if ENABLED(INPUT_SHAPING)
+  #include "../feature/input_shaping.h"
+#endif
+
 #if ENABLED(EXTRA_LIN_ADVANCE_K)
   extern float other_extruder_advance_K[EXTRUDERS];
 #endif
@@ -403,6 +407,13 @@ typedef struct SettingsDataStruct {
     uint8_t case_light_brightness;
   #endif
 
+  //
+  // INPUT_SHAPING
+  //
+  #if ENABLED(INPUT_SHAPING)
+    shaper_settings_t shaper_settings[SHAPING_AXES];    // M593 X Y F D T
+  #endif
+
 } SettingsData;
 
 //static_assert(sizeof(SettingsData) <= MARLIN_EEPROM_SIZE, "EEPROM too small to contain SettingsData!");
@@ -456,6 +467,8 @@ void MarlinSettings::postprocess() {
 
   TERN_(HAS_CASE_LIGHT_BRIGHTNESS, update_case_light());
 
+  TERN_(INPUT_SHAPING, input_shaping.refresh());
+
   // Refresh steps_to_mm with the reciprocal of axis_steps_per_mm
   // and init stepper.count[], planner.position[] with current_position
   planner.refresh_positioning();
@@ -557,7 +570,13 @@ void MarlinSettings::postprocess() {
     eeprom_error = false;
 
     // Write or Skip version. (Flash doesn't allow rewrite without erase.)
-    TERN(FLASH_EEPROM_EMULATION, EEPROM_SKIP, EEPROM_WRITE)(ver);
+    // Stores that only write out changes in access_finish() don't need the placeholder,
+    // and writing it would make every save look like a change.
+    #if ANY(FLASH_EEPROM_EMULATION, SDCARD_EEPROM_EMULATION) || defined(__PLAT_LINUX__)
+      EEPROM_SKIP(ver);
+    #else
+      EEPROM_WRITE(ver);
+    #endif
 
     EEPROM_SKIP(working_crc); // Skip the checksum slot
 
@@ -1337,6 +1356,14 @@ void MarlinSettings::postprocess() {
       EEPROM_WRITE(case_light_brightness);
     #endif
 
+    //
+    // Input Shaping
+    //
+    #if ENABLED(INPUT_SHAPING)
+      _FIELD_TEST(shaper_settings);
+      LOOP_L_N(a, SHAPING_AXES) EEPROM_WRITE(input_shaping.axis[a].settings);
+    #endif
+
     //
     // Validate CRC and Data Size
     //
@@ -2170,6 +2197,14 @@ void MarlinSettings::postprocess() {
         EEPROM_READ(case_light_brightness);
       #endif
 
+      //
+      // Input Shaping
+      //
+      #if ENABLED(INPUT_SHAPING)
+        _FIELD_TEST(shaper_settings);
+        LOOP_L_N(a, SHAPING_AXES) EEPROM_READ(input_shaping.axis[a].settings);
+      #endif
+
       eeprom_error = size_error(eeprom_index - (EEPROM_OFFSET));
       if (eeprom_error) {
         DEBUG_ECHO_START();
@@ -2346,6 +2381,10 @@ void MarlinSettings::postprocess() {
         if (status) SERIAL_ECHOLNPGM("?Unable to load mesh data.");
         else        DEBUG_ECHOLNPAIR("Mesh loaded from slot ", slot);
 
+        #if ENABLED(MESH_CELL_CACHE)
+          if (!into) refresh_mesh_cells();
+        #endif
+
         EEPROM_FINISH();
 
       #else
@@ -2472,6 +2511,11 @@ void MarlinSettings::reset() {
   //
   TERN_(HAS_CASE_LIGHT_BRIGHTNESS, case_light_brightness = CASE_LIGHT_DEFAULT_BRIGHTNESS);
 
+  //
+  // Input Shaping
+  //
+  TERN_(INPUT_SHAPING, input_shaping.reset());
+
   //
   // Magnetic Parking Extruder
   //
@@ -3664,6 +3708,20 @@ void MarlinSettings::reset() {
       );
     #endif
 
+    #if ENABLED(INPUT_SHAPING)
+      CONFIG_ECHO_HEADING("Input shaping:");
+      LOOP_L_N(a, SHAPING_AXES) {
+        const shaper_settings_t &s = input_shaping.axis[a].settings;
+        CONFIG_ECHO_START();
+        SERIAL_ECHOLNPAIR_P(
+            PSTR("  M593 "), axis_codes[a]
+          , PSTR(" F"), s.frequency
+          , PSTR(" D"), s.zeta
+          , PSTR(" T"), int(s.type)
+        );
+      }
+    #endif
+
     #if HAS_FILAMENT_SENSOR
       CONFIG_ECHO_HEADING("Filament runout sensor:");
       CONFIG_ECHO_START();
@@ -82,6 +82,29 @@ void recalc_delta_settings() {
   set_all_unhomed();
 }
 
+#ifdef KINEMATIC_SEGMENT_TOLERANCE
+
+  /**
+   * Along a move, each tower height is  h = z + sqrt(D² - r²)  where D² is
+   * delta_diagonal_rod_2_tower and r is the XY distance from the tower.
+   * Over the whole move  h'' <= |xy|² * D² / s³  where  s = sqrt(D² - r²)
+   * at the end furthest from the tower (r² is largest at one of the ends).
+   * A straight step over 1/n of the move strays at most h'' / (8 * n²).
+   */
+  float kinematic_segments(const xy_pos_t &start, const xy_pos_t &end) {
+    float k = 0;
+    LOOP_ABC(t) {
+      const float r2 = _MAX(HYPOT2(delta_tower[t].x - start.x, delta_tower[t].y - start.y),
+                            HYPOT2(delta_tower[t].x - end.x, delta_tower[t].y - end.y)),
+                  s2 = _MAX(delta_diagonal_rod_2_tower[t] - r2, 1.0f); // Unreachable ends are caught by the caller
+      NOLESS(k, delta_diagonal_rod_2_tower[t] / (s2 * SQRT(s2)));
+    }
+    const xy_pos_t d = end - start;
+    return SQRT(HYPOT2(d.x, d.y) * k * (1000.0f / 8) / (KINEMATIC_SEGMENT_TOLERANCE));
+  }
+
+#endif
+
 /**
  * Get a safe radius for calibration
  */
@@ -139,6 +162,30 @@ void inverse_kinematics(const xyz_pos_t &raw) {
   #endif
 }
 
+/**
+ * Batch Inverse Kinematics, as above for a run of segments.
+ *
+ * The tower constants are loaded once for the whole batch and
+ * the loop only touches the two arrays, so host builds with
+ * -fno-math-errno can vectorize it.
+ */
+void _O3 inverse_kinematics(const xyze_pos_t * __restrict raw, abc_pos_t * __restrict joints, const uint8_t count) {
+  const float ax = delta_tower[A_AXIS].x, ay = delta_tower[A_AXIS].y, a2 = delta_diagonal_rod_2_tower.a,
+              bx = delta_tower[B_AXIS].x, by = delta_tower[B_AXIS].y, b2 = delta_diagonal_rod_2_tower.b,
+              cx = delta_tower[C_AXIS].x, cy = delta_tower[C_AXIS].y, c2 = delta_diagonal_rod_2_tower.c;
+  #if HAS_HOTEND_OFFSET
+    const float ox = hotend_offset[active_extruder].x, oy = hotend_offset[active_extruder].y;
+  #else
+    constexpr float ox = 0, oy = 0;
+  #endif
+  LOOP_L_N(i, count) {
+    const float x = raw[i].x - ox, y = raw[i].y - oy, z = raw[i].z;
+    joints[i].a = z + SQRT(a2 - HYPOT2(ax - x, ay - y));
+    joints[i].b = z + SQRT(b2 - HYPOT2(bx - x, by - y));
+    joints[i].c = z + SQRT(c2 - HYPOT2(cx - x, cy - y));
+  }
+}
+
 /**
  * Calculate the highest Z position where the
  * effector has the full range of XY motion.
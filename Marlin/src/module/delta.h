@@ -45,6 +45,14 @@ extern abc_float_t delta_diagonal_rod_trim;
  */
 void recalc_delta_settings();
 
+#ifdef KINEMATIC_SEGMENT_TOLERANCE
+  /**
+   * Number of segments (not rounded) needed to keep the
+   * towers within KINEMATIC_SEGMENT_TOLERANCE of the path
+   */
+  float kinematic_segments(const xy_pos_t &start, const xy_pos_t &end);
+#endif
+
 /**
  * Get a safe radius for calibration
  */
@@ -89,6 +97,9 @@ void recalc_delta_settings();
 
 void inverse_kinematics(const xyz_pos_t &raw);
 
+// Inverse Kinematics for 'count' positions, into joints[]
+void inverse_kinematics(const xyze_pos_t raw[], abc_pos_t joints[], const uint8_t count);
+
 /**
  * Calculate the highest Z position where the
  * effector has the full range of XY motion.
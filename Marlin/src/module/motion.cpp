@@ -757,12 +757,22 @@ FORCE_INLINE void segment_idle(millis_t &next_idle_ms) {
     // No E move either? Game over.
     if (UNEAR_ZERO(cartesian_mm)) return true;
 
-    // Minimum number of seconds to move the given distance
-    const float seconds = cartesian_mm / scaled_fr_mm_s;
+    #ifdef KINEMATIC_SEGMENT_TOLERANCE
 
-    // The number of segments-per-second times the duration
-    // gives the number of segments
-    uint16_t segments = delta_segments_per_second * seconds;
+      // Enough segments to keep the kinematic error in tolerance,
+      // but none shorter than 0.1mm
+      uint16_t segments = CEIL(_MIN(kinematic_segments(current_position, destination), cartesian_mm * 10));
+
+    #else
+
+      // Minimum number of seconds to move the given distance
+      const float seconds = cartesian_mm / scaled_fr_mm_s;
+
+      // The number of segments-per-second times the duration
+      // gives the number of segments
+      uint16_t segments = delta_segments_per_second * seconds;
+
+    #endif
 
     // For SCARA enforce a minimum segment size
     #if IS_SCARA
@@ -783,34 +793,31 @@ FORCE_INLINE void segment_idle(millis_t &next_idle_ms) {
 
     /*
     SERIAL_ECHOPAIR("mm=", cartesian_mm);
-    SERIAL_ECHOPAIR(" seconds=", seconds);
     SERIAL_ECHOPAIR(" segments=", segments);
     SERIAL_ECHOPAIR(" segment_mm=", cartesian_segment_mm);
     SERIAL_EOL();
     //*/
 
     // Get the current position as starting point
-    xyze_pos_t raw = current_position;
+    xyze_pos_t raw = current_position, batch[KINEMATIC_BATCH_SIZE];
 
-    // Calculate and execute the segments
+    // Calculate and execute the segments, a batch at a time
     millis_t next_idle_ms = millis() + 200UL;
-    while (--segments) {
+    while (segments) {
       segment_idle(next_idle_ms);
-      raw += segment_distance;
-      if (!planner.buffer_line(raw, scaled_fr_mm_s, active_extruder, cartesian_segment_mm
+      const uint8_t count = _MIN(segments, KINEMATIC_BATCH_SIZE);
+      LOOP_L_N(i, count) {
+        // Ensure last segment arrives at target location.
+        if (--segments) raw += segment_distance; else raw = destination;
+        batch[i] = raw;
+      }
+      if (planner.buffer_lines(batch, count, scaled_fr_mm_s, active_extruder, cartesian_segment_mm
         #if ENABLED(SCARA_FEEDRATE_SCALING)
           , inv_duration
         #endif
-      )) break;
+      ) < count) break;
     }
 
-    // Ensure last segment arrives at target location.
-    planner.buffer_line(destination, scaled_fr_mm_s, active_extruder, cartesian_segment_mm
-      #if ENABLED(SCARA_FEEDRATE_SCALING)
-        , inv_duration
-      #endif
-    );
-
     return false; // caller will update current_position
   }
 
@@ -99,12 +99,18 @@
   #include "../feature/backlash.h"
 #endif
 
+#if ENABLED(INPUT_SHAPING)
+  #include "../feature/input_shaping.h"
+#endif
+
 #if ENABLED(CANCEL_OBJECTS)
   #include "../feature/cancel_object.h"
 #endif
 
 #if ENABLED(POWER_LOSS_RECOVERY)
   #include "../feature/powerloss.h"
+#elif ENABLED(PRINT_TIME_ESTIMATE)
+  #include "../sd/cardreader.h"
 #endif
 
 #if HAS_CUTTER
@@ -209,6 +215,10 @@ xyze_long_t Planner::position{0};
 
 uint32_t Planner::cutoff_long;
 
+#if ENABLED(ARC_BLOCKS)
+  const Planner::arc_plan_t *Planner::arc_plan; // = nullptr
+#endif
+
 xyze_float_t Planner::previous_speed;
 float Planner::previous_nominal_speed_sqr;
 
@@ -838,6 +848,13 @@ void Planner::calculate_trapezoid_for_block(block_t* const block, const float &e
   #endif
   block->final_rate = final_rate;
 
+  #if ENABLED(PRINT_TIME_ESTIMATE)
+    // Time to accelerate to the peak rate, cruise, and decelerate, for the print time estimate
+    float peak_rate = plateau_steps > 0 ? float(block->nominal_rate) : SQRT(sq(float(initial_rate)) + 2.0f * accel * accelerate_steps);
+    NOLESS(peak_rate, float(_MAX(initial_rate, final_rate)));
+    block->move_time_us = 1000000.0f * ((2.0f * peak_rate - initial_rate - final_rate) / accel + plateau_steps / peak_rate);
+  #endif
+
   /**
    * Laser trapezoid calculations
    *
@@ -993,8 +1010,17 @@ void Planner::reverse_pass_kernel(block_t* const current, const block_t * const
 /**
  * recalculate() needs to go over the current plan twice.
  * Once in reverse and once forward. This implements the reverse pass.
+ *
+ * The entry speed of a block depends only on the entry speed of the block
+ * after it, so once a block keeps the entry speed it already had, none of
+ * the blocks before it can change either. The pass stops there, making the
+ * cost of adding a block proportional to how far its effect reaches instead
+ * of to the number of queued blocks.
+ *
+ * Returns the index of the oldest block that was examined. Blocks before it
+ * are unchanged, so the forward pass and trapezoid update can start there.
  */
-void Planner::reverse_pass() {
+uint8_t Planner::reverse_pass() {
   // Initialize block index to the last block in the planner buffer.
   uint8_t block_index = prev_block_index(block_buffer_head);
 
@@ -1005,7 +1031,7 @@ void Planner::reverse_pass() {
   // If there was a race condition and block_buffer_planned was incremented
   //  or was pointing at the head (queue empty) break loop now and avoid
   //  planning already consumed blocks
-  if (planned_block_index == block_buffer_head) return;
+  if (planned_block_index == block_buffer_head) return planned_block_index;
 
   // Reverse Pass: Coarsely maximize all possible deceleration curves back-planning from the last
   // block in buffer. Cease planning when the last optimal planned or tail pointer is reached.
@@ -1018,7 +1044,13 @@ void Planner::reverse_pass() {
 
     // Only consider non sync and page blocks
     if (!TEST(current->flag, BLOCK_BIT_SYNC_POSITION) && !IS_PAGE(current)) {
+      const float old_entry_speed_sqr = current->entry_speed_sqr;
       reverse_pass_kernel(current, next);
+
+      // The newest block entry speed is only a guess until planned. For any other
+      // block, an unchanged entry speed means the previous blocks are also final.
+      if (next && current->entry_speed_sqr == old_entry_speed_sqr) return block_index;
+
       next = current;
     }
 
@@ -1031,12 +1063,14 @@ void Planner::reverse_pass() {
     while (planned_block_index != block_buffer_planned) {
 
       // If we reached the busy block or an already processed block, break the loop now
-      if (block_index == planned_block_index) return;
+      if (block_index == planned_block_index) return planned_block_index;
 
       // Advance the pointer, following the busy block
       planned_block_index = next_block_index(planned_block_index);
     }
   }
+
+  return planned_block_index;
 }
 
 // The kernel called by recalculate() when scanning the plan from first to last entry.
@@ -1092,8 +1126,11 @@ void Planner::forward_pass_kernel(const block_t* const previous, block_t* const
 /**
  * recalculate() needs to go over the current plan twice.
  * Once in reverse and once forward. This implements the forward pass.
+ *
+ * Junctions before 'first' were left untouched by the reverse pass and
+ * already passed the previous forward pass, so they are skipped.
  */
-void Planner::forward_pass() {
+void Planner::forward_pass(const uint8_t first) {
 
   // Forward Pass: Forward plan the acceleration curve from the planned pointer onward.
   // Also scans for optimal plan breakpoints and appropriately updates the planned pointer.
@@ -1104,6 +1141,11 @@ void Planner::forward_pass() {
   //  pass will never modify the values at the tail.
   uint8_t block_index = block_buffer_planned;
 
+  // Start at the first block the reverse pass looked at, unless
+  // the ISR already pushed the planned pointer beyond it.
+  if (BLOCK_MOD(block_buffer_head - first) < BLOCK_MOD(block_buffer_head - block_index))
+    block_index = first;
+
   block_t *block;
   const block_t * previous = nullptr;
   while (block_index != block_buffer_head) {
@@ -1131,11 +1173,17 @@ void Planner::forward_pass() {
  * Recalculate the trapezoid speed profiles for all blocks in the plan
  * according to the entry_factor for each junction. Must be called by
  * recalculate() after updating the blocks.
+ *
+ * Only junctions from 'first' onward can have changed, so the scan
+ * starts there if the block hasn't been consumed in the meantime.
  */
-void Planner::recalculate_trapezoids() {
+void Planner::recalculate_trapezoids(const uint8_t first) {
   // The tail may be changed by the ISR so get a local copy.
   uint8_t block_index = block_buffer_tail,
           head_block_index = block_buffer_head;
+
+  if (BLOCK_MOD(head_block_index - first) < BLOCK_MOD(head_block_index - block_index))
+    block_index = first;
   // Since there could be a sync block in the head of the queue, and the
   // next loop must not recalculate the head block (as it needs to be
   // specially handled), scan backwards to the first non-SYNC block.
@@ -1243,10 +1291,12 @@ void Planner::recalculate() {
   const uint8_t block_index = prev_block_index(block_buffer_head);
   // If there is just one block, no planning can be done. Avoid it!
   if (block_index != block_buffer_planned) {
-    reverse_pass();
-    forward_pass();
+    const uint8_t first = reverse_pass();
+    forward_pass(first);
+    recalculate_trapezoids(first);
   }
-  recalculate_trapezoids();
+  else
+    recalculate_trapezoids(block_buffer_tail);
 }
 
 #if ENABLED(AUTOTEMP)
@@ -1493,7 +1543,7 @@ void Planner::check_axes_activity() {
             #endif
           )
         #elif ENABLED(AUTO_BED_LEVELING_UBL)
-          fade_scaling_factor ? fade_scaling_factor * ubl.get_z_correction(raw) : 0.0
+          fade_scaling_factor ? fade_scaling_factor * TERN(MESH_CELL_CACHE, ubl.get_z_correction_fast(raw), ubl.get_z_correction(raw)) : 0.0
         #elif ENABLED(AUTO_BED_LEVELING_BILINEAR)
           fade_scaling_factor ? fade_scaling_factor * bilinear_z_offset(raw) : 0.0
         #endif
@@ -1530,7 +1580,7 @@ void Planner::check_axes_activity() {
               #endif
             )
           #elif ENABLED(AUTO_BED_LEVELING_UBL)
-            fade_scaling_factor ? fade_scaling_factor * ubl.get_z_correction(raw) : 0.0
+            fade_scaling_factor ? fade_scaling_factor * TERN(MESH_CELL_CACHE, ubl.get_z_correction_fast(raw), ubl.get_z_correction(raw)) : 0.0
           #elif ENABLED(AUTO_BED_LEVELING_BILINEAR)
             fade_scaling_factor ? fade_scaling_factor * bilinear_z_offset(raw) : 0.0
           #endif
@@ -1571,6 +1621,9 @@ void Planner::quick_stop() {
   // Drop all queue entries
   block_buffer_nonbusy = block_buffer_planned = block_buffer_head = block_buffer_tail;
 
+  // Drop the rest of a curve
+  TERN_(HAS_SEGMENT_GENERATOR, segment_generator = nullptr);
+
   // Restart the block delay for the first movement - As the queue was
   // forced to empty, there's no risk the ISR will touch this.
   delay_before_delivering = BLOCK_DELAY_FOR_1ST_MOVE;
@@ -1637,9 +1690,22 @@ float Planner::get_axis_position_mm(const AxisEnum axis) {
 /**
  * Block until all buffered steps are executed / cleaned
  */
+#if HAS_SEGMENT_GENERATOR
+
+  Planner::segment_generator_t Planner::segment_generator; // = nullptr
+
+  bool Planner::run_segment_generator() {
+    if (segment_generator && moves_free() && !segment_generator()) segment_generator = nullptr;
+    return segment_generator != nullptr;
+  }
+
+#endif
+
 void Planner::synchronize() {
+  TERN_(HAS_SEGMENT_GENERATOR, finish_segments());
   while (has_blocks_queued() || cleaning_buffer_counter
       || TERN0(EXTERNAL_CLOSED_LOOP_CONTROLLER, CLOSED_LOOP_WAITING())
+      || !TERN1(INPUT_SHAPING, input_shaping.idle())
   ) idle();
 }
 
@@ -1812,6 +1878,15 @@ bool Planner::_populate_block(block_t * const block, bool split_move,
   #endif
   if (de < 0) SBI(dm, E_AXIS);
 
+  #if ENABLED(ARC_BLOCKS)
+    // An arc starts X and Y along its tangent. The stepper reverses them as it goes around.
+    if (arc_plan) {
+      dm &= ~(_BV(X_AXIS) | _BV(Y_AXIS));
+      if (arc_plan->start_dir.x < 0) SBI(dm, X_AXIS);
+      if (arc_plan->start_dir.y < 0) SBI(dm, Y_AXIS);
+    }
+  #endif
+
   #if EXTRUDERS
     const float esteps_float = de * e_factor[extruder];
     const uint32_t esteps = ABS(esteps_float) + 0.5f;
@@ -1822,6 +1897,13 @@ bool Planner::_populate_block(block_t * const block, bool split_move,
   // Clear all flags, including the "busy" bit
   block->flag = 0x00;
 
+  #if ENABLED(ARC_BLOCKS)
+    if (arc_plan) {
+      block->flag = BLOCK_FLAG_IS_ARC;
+      block->arc = arc_plan->block;
+    }
+  #endif
+
   // Set direction bits
   block->direction_bits = dm;
 
@@ -1847,6 +1929,9 @@ bool Planner::_populate_block(block_t * const block, bool split_move,
     block->steps.set(ABS(da), ABS(db), ABS(dc));
   #endif
 
+  // X and Y may each step on any event of an arc
+  TERN_(ARC_BLOCKS, if (arc_plan) block->steps.a = block->steps.b = arc_plan->events);
+
   /**
    * This part of the code calculates the total length of the movement.
    * For cartesian bots, the X_AXIS is the real X movement and same for Y_AXIS.
@@ -1884,6 +1969,14 @@ bool Planner::_populate_block(block_t * const block, bool split_move,
     steps_dist_mm.c = dc * steps_to_mm[C_AXIS];
   #endif
 
+  #if ENABLED(ARC_BLOCKS)
+    // Use the start tangent of an arc for its entry junction
+    if (arc_plan) {
+      steps_dist_mm.a = arc_plan->start_dir.x * arc_plan->flat_mm;
+      steps_dist_mm.b = arc_plan->start_dir.y * arc_plan->flat_mm;
+    }
+  #endif
+
   #if EXTRUDERS
     steps_dist_mm.e = esteps_float * steps_to_mm[E_AXIS_N(extruder)];
   #else
@@ -2093,6 +2186,15 @@ bool Planner::_populate_block(block_t * const block, bool split_move,
     if (cs > max_fr) NOMORE(speed_factor, max_fr / cs);
   }
 
+  #if ENABLED(ARC_BLOCKS)
+    // X and Y each reach the full XY speed somewhere around an arc
+    if (arc_plan) {
+      const feedRate_t cs = arc_plan->flat_mm * inverse_secs,
+                   max_fr = _MIN(settings.max_feedrate_mm_s[X_AXIS], settings.max_feedrate_mm_s[Y_AXIS]);
+      if (cs > max_fr) NOMORE(speed_factor, max_fr / cs);
+    }
+  #endif
+
   // Limit speed on extruders, if any
   #if EXTRUDERS
     {
@@ -2220,9 +2322,9 @@ bool Planner::_populate_block(block_t * const block, bool split_move,
           #if IS_KINEMATIC
             block->millimeters
           #else
-            SQRT(sq(target_float.x - position_float.x)
-               + sq(target_float.y - position_float.y)
-               + sq(target_float.z - position_float.z))
+            (IS_ARC(block) ? block->millimeters : SQRT(sq(target_float.x - position_float.x)
+                                                     + sq(target_float.y - position_float.y)
+                                                     + sq(target_float.z - position_float.z)))
           #endif
         ;
 
@@ -2450,6 +2552,14 @@ bool Planner::_populate_block(block_t * const block, bool split_move,
 
     prev_unit_vec = unit_vec;
 
+    #if ENABLED(ARC_BLOCKS)
+      // An arc leaves along a different tangent than it came in on
+      if (arc_plan) {
+        prev_unit_vec.set(arc_plan->end_dir.x * arc_plan->flat_mm, arc_plan->end_dir.y * arc_plan->flat_mm, steps_dist_mm.z, steps_dist_mm.e);
+        normalize_junction_vector(prev_unit_vec);
+      }
+    #endif
+
   #endif
 
   #ifdef USE_CACHED_SQRT
@@ -2583,13 +2693,24 @@ bool Planner::_populate_block(block_t * const block, bool split_move,
 
   // Update previous path unit_vector and nominal speed
   previous_speed = current_speed;
+  #if ENABLED(ARC_BLOCKS)
+    if (arc_plan) {
+      const float exit_speed = arc_plan->flat_mm * inverse_secs * speed_factor;
+      previous_speed.x = arc_plan->end_dir.x * exit_speed;
+      previous_speed.y = arc_plan->end_dir.y * exit_speed;
+    }
+  #endif
   previous_nominal_speed_sqr = block->nominal_speed_sqr;
 
   position = target;  // Update the position
 
   TERN_(HAS_POSITION_FLOAT, position_float = target_float);
   TERN_(GRADIENT_MIX, mixer.gradient_control(target_float.z));
-  TERN_(POWER_LOSS_RECOVERY, block->sdpos = recovery.command_sdpos());
+  #if ENABLED(POWER_LOSS_RECOVERY)
+    block->sdpos = recovery.command_sdpos();
+  #elif ENABLED(PRINT_TIME_ESTIMATE)
+    block->sdpos = card.getIndex();   // A few commands ahead, at most
+  #endif
 
   return true;        // Movement was accepted
 
@@ -2739,51 +2860,200 @@ bool Planner::buffer_line(const float &rx, const float &ry, const float &rz, con
     , const float &inv_duration
   #endif
 ) {
-  xyze_pos_t machine = { rx, ry, rz, e };
+  const xyze_pos_t cart = { rx, ry, rz, e };
+  xyze_pos_t machine = cart;
   TERN_(HAS_POSITION_MODIFIERS, apply_modifiers(machine));
 
   #if IS_KINEMATIC
+    // Cartesian XYZ to kinematic ABC, stored in global 'delta'
+    inverse_kinematics(machine);
+    return buffer_kinematic(cart, delta, machine.e, fr_mm_s, extruder, millimeters
+      #if ENABLED(SCARA_FEEDRATE_SCALING)
+        , inv_duration
+      #endif
+    );
+  #else
+    return buffer_segment(machine, fr_mm_s, extruder, millimeters);
+  #endif
+} // buffer_line()
+
+#if IS_KINEMATIC
 
+  /**
+   * Add a segment to the buffer given its cartesian target
+   * and the joint positions worked out from it.
+   */
+  bool Planner::buffer_kinematic(const xyze_pos_t &cart, const abc_pos_t &joints, const float &e, const feedRate_t &fr_mm_s, const uint8_t extruder, const float millimeters
+    #if ENABLED(SCARA_FEEDRATE_SCALING)
+      , const float &inv_duration
+    #endif
+  ) {
     #if HAS_JUNCTION_DEVIATION
-      const xyze_pos_t cart_dist_mm = {
-        rx - position_cart.x, ry - position_cart.y,
-        rz - position_cart.z, e  - position_cart.e
-      };
+      const xyze_pos_t cart_dist_mm = cart - position_cart;
     #else
-      const xyz_pos_t cart_dist_mm = { rx - position_cart.x, ry - position_cart.y, rz - position_cart.z };
+      const xyz_pos_t cart_dist_mm = { cart.x - position_cart.x, cart.y - position_cart.y, cart.z - position_cart.z };
     #endif
 
     float mm = millimeters;
     if (mm == 0.0)
       mm = (cart_dist_mm.x != 0.0 || cart_dist_mm.y != 0.0) ? cart_dist_mm.magnitude() : ABS(cart_dist_mm.z);
 
-    // Cartesian XYZ to kinematic ABC, stored in global 'delta'
-    inverse_kinematics(machine);
-
     #if ENABLED(SCARA_FEEDRATE_SCALING)
       // For SCARA scale the feed rate from mm/s to degrees/s
       // i.e., Complete the angular vector in the given time.
       const float duration_recip = inv_duration ?: fr_mm_s / mm;
-      const xyz_pos_t diff = delta - position_float;
+      const xyz_pos_t diff = joints - position_float;
       const feedRate_t feedrate = diff.magnitude() * duration_recip;
     #else
       const feedRate_t feedrate = fr_mm_s;
     #endif
-    if (buffer_segment(delta.a, delta.b, delta.c, machine.e
+    if (buffer_segment(joints.a, joints.b, joints.c, e
       #if HAS_JUNCTION_DEVIATION
         , cart_dist_mm
       #endif
       , feedrate, extruder, mm
     )) {
-      position_cart.set(rx, ry, rz, e);
+      position_cart = cart;
       return true;
     }
     else
       return false;
-  #else
-    return buffer_segment(machine, fr_mm_s, extruder, millimeters);
-  #endif
-} // buffer_line()
+  }
+
+  uint8_t Planner::buffer_lines(const xyze_pos_t cart[], const uint8_t count, const feedRate_t &fr_mm_s, const uint8_t extruder, const float millimeters
+    #if ENABLED(SCARA_FEEDRATE_SCALING)
+      , const float &inv_duration
+    #endif
+  ) {
+    xyze_pos_t machine[KINEMATIC_BATCH_SIZE];
+    abc_pos_t joints[KINEMATIC_BATCH_SIZE];
+
+    // Apply leveling, skew, etc. to every target (count is never 0)
+    uint8_t n = 0;
+    do {
+      machine[n] = cart[n];
+      TERN_(HAS_POSITION_MODIFIERS, apply_modifiers(machine[n]));
+    } while (++n < count);
+
+    // Cartesian XYZ to kinematic ABC for the whole batch
+    inverse_kinematics(machine, joints, count);
+
+    LOOP_L_N(i, count)
+      if (!buffer_kinematic(cart[i], joints[i], machine[i].e, fr_mm_s, extruder, millimeters
+        #if ENABLED(SCARA_FEEDRATE_SCALING)
+          , inv_duration
+        #endif
+      )) return i;
+
+    return count;
+  }
+
+#endif
+
+#if ENABLED(ARC_BLOCKS)
+
+  /**
+   * Add an XY arc to the buffer as a single block.
+   *
+   * The stepper turns a radius vector (in steps) by a fixed angle on every step
+   * event, so this only has to pick the angle and event count, work out where
+   * the fixed-point rotation will finish, and spread any difference from the
+   * real target over the arc. Z and E are stepped by Bresenham as usual.
+   *
+   * The arc must start at the current planner position. Return 'false', having
+   * queued nothing, if the arc doesn't fit in one block. The caller should then
+   * buffer it as line segments.
+   */
+  bool Planner::buffer_arc(const xyze_pos_t &cart, const xy_pos_t &center, const float &angular_travel,
+                           const float &millimeters, feedRate_t fr_mm_s, const uint8_t extruder
+  ) {
+    // The radius vector is in X steps, so Y must have the same resolution
+    const float spm = settings.axis_steps_per_mm[X_AXIS];
+    if (spm != settings.axis_steps_per_mm[Y_AXIS] || TERN0(HAS_LEVELING, leveling_active)) return false;
+
+    xyze_pos_t machine = cart;
+    TERN_(HAS_POSITION_MODIFIERS, apply_modifiers(machine));
+
+    // Start and end relative to the center, in steps
+    const xy_long_t target = { int32_t(LROUND(machine.x * spm)), int32_t(LROUND(machine.y * spm)) };
+    const xy_pos_t c = center * spm,
+                   p0 = { position.x - c.x, position.y - c.y },
+                   p1 = { target.x - c.x, target.y - c.y };
+    const float r = p0.magnitude(), r1 = p1.magnitude();
+    if (!WITHIN(r, ARC_BLOCK_MIN_RADIUS, ARC_BLOCK_MAX_RADIUS) || r1 < ARC_BLOCK_MIN_RADIUS) return false;
+
+    // Turn no more than 3/4 step per event so X and Y never need two steps in one
+    const float travel = ABS(angular_travel);
+    uint32_t events = CEIL(travel * r * (4.0f / 3.0f));
+
+    // Z and E are stepped by Bresenham, so the arc needs at least as many events
+    const uint32_t zsteps = ABS(int32_t(LROUND(machine.z * settings.axis_steps_per_mm[Z_AXIS])) - position.z) + 1
+      #if EXTRUDERS
+        , esteps = ABS((int32_t(LROUND(machine.e * settings.axis_steps_per_mm[E_AXIS_N(extruder)])) - position.e) * e_factor[extruder]) + 2
+      #endif
+    ;
+    NOLESS(events, zsteps);
+    #if EXTRUDERS
+      NOLESS(events, esteps);
+    #endif
+
+    /**
+     * Shear coefficients for the per-event angle φ. Rounding 'a' and then
+     * deriving 'b' from it keeps the three shears close to a true rotation.
+     * The exact angle they turn is then given by cos(φ) = 1 - a * b.
+     */
+    constexpr float coeff_one = float(1UL << ARC_COEFF_FRAC);
+    const float t = tanf(travel / events * 0.5f);
+    const int32_t a = LROUND(t * coeff_one);
+    if (a < 1) return false;
+    const float aq = a / coeff_one,
+                bq = 2 * aq / (1 + sq(aq)),
+                phi = 2 * asinf(SQRT(aq * bq * 0.5f));
+    const int32_t b = LROUND(bq * coeff_one);
+
+    // The event count that comes closest to the target angle
+    events = _MAX(uint32_t(LROUND(travel / phi)), zsteps);
+    #if EXTRUDERS
+      NOLESS(events, esteps);
+    #endif
+
+    /**
+     * Where the interpolator will end up. The shears are conjugate to a
+     * rotation by φ, so after N events the vector is:
+     *   cos(Nφ) * p0 + sin(Nφ) / sin(φ) * (M - cos(φ)) * p0
+     */
+    const float sign = angular_travel < 0 ? -1 : 1,
+                turn = events * phi, cos_n = cosf(turn), sin_n = sinf(turn) / sinf(phi),
+                sa = sign * aq * (2 - aq * bq), sb = sign * bq;
+    const xy_pos_t pn = { cos_n * p0.x - sin_n * sa * p0.y, cos_n * p0.y + sin_n * sb * p0.x },
+                   drift = p1 - pn;
+
+    // The drift is spread over the arc, and must leave room in every event for the turn
+    const float max_drift = _MIN(events * 0.25f, 64.0f);
+    if (ABS(drift.x) > max_drift || ABS(drift.y) > max_drift) return false;
+
+    constexpr float pos_one = float(1UL << ARC_POS_FRAC);
+    arc_plan_t plan;
+    plan.block.start.set(LROUND(p0.x * pos_one), LROUND(p0.y * pos_one));
+    plan.block.correction.set(LROUND(drift.x * pos_one / events), LROUND(drift.y * pos_one / events));
+    plan.block.end.set(target.x - position.x, target.y - position.y);
+    plan.block.a = angular_travel < 0 ? -a : a;
+    plan.block.b = angular_travel < 0 ? -b : b;
+    plan.events = events;
+    plan.start_dir.set(-sign * p0.y / r, sign * p0.x / r);
+    plan.end_dir.set(-sign * p1.y / r1, sign * p1.x / r1);
+    plan.flat_mm = travel * r / spm;
+
+    // Keep the centripetal acceleration within the XY limits
+    NOMORE(fr_mm_s, SQRT(plan.flat_mm / travel * _MIN(settings.max_acceleration_mm_per_s2[X_AXIS], settings.max_acceleration_mm_per_s2[Y_AXIS])));
+
+    arc_plan = &plan;
+    const bool queued = buffer_segment(machine, fr_mm_s, extruder, millimeters);
+    arc_plan = nullptr;
+    return queued;
+  }
+
+#endif // ARC_BLOCKS
 
 #if ENABLED(DIRECT_STEPPING)
 
@@ -2798,6 +3068,8 @@ bool Planner::buffer_line(const float &rx, const float &ry, const float &rz, con
 
     block->flag = BLOCK_FLAG_IS_PAGE;
 
+    TERN_(PRINT_TIME_ESTIMATE, block->move_time_us = 0);
+
     #if FAN_COUNT > 0
       FANS_LOOP(i) block->fan_speed[i] = thermalManager.fan_speed[i];
     #endif
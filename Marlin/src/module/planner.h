@@ -73,6 +73,12 @@
   #define IS_PAGE(B) false
 #endif
 
+#if ENABLED(ARC_BLOCKS)
+  #define IS_ARC(B) TEST(B->flag, BLOCK_BIT_IS_ARC)
+#else
+  #define IS_ARC(B) false
+#endif
+
 // Feedrate for manual moves
 #ifdef MANUAL_FEEDRATE
   constexpr xyze_feedrate_t _mf = MANUAL_FEEDRATE,
@@ -83,6 +89,15 @@
   #define HAS_DIST_MM_ARG 1
 #endif
 
+#if IS_KINEMATIC
+  // Segments given to buffer_lines at once
+  #ifdef __AVR__
+    #define KINEMATIC_BATCH_SIZE 4
+  #else
+    #define KINEMATIC_BATCH_SIZE 16
+  #endif
+#endif
+
 enum BlockFlagBit : char {
   // Recalculate trapezoids on entry junction. For optimization.
   BLOCK_BIT_RECALCULATE,
@@ -102,6 +117,11 @@ enum BlockFlagBit : char {
   #if ENABLED(DIRECT_STEPPING)
     , BLOCK_BIT_IS_PAGE
   #endif
+
+  // XY arc stepped by the circle interpolator
+  #if ENABLED(ARC_BLOCKS)
+    , BLOCK_BIT_IS_ARC
+  #endif
 };
 
 enum BlockFlag : char {
@@ -112,8 +132,35 @@ enum BlockFlag : char {
   #if ENABLED(DIRECT_STEPPING)
     , BLOCK_FLAG_IS_PAGE            = _BV(BLOCK_BIT_IS_PAGE)
   #endif
+  #if ENABLED(ARC_BLOCKS)
+    , BLOCK_FLAG_IS_ARC             = _BV(BLOCK_BIT_IS_ARC)
+  #endif
 };
 
+#if ENABLED(ARC_BLOCKS)
+
+  // Fixed-point formats used by the circle interpolator
+  #define ARC_POS_FRAC   16                 // Radius vector, in steps
+  #define ARC_COEFF_FRAC 30                 // Rotation shear coefficients
+  #define ARC_BLOCK_MIN_RADIUS 4            // (steps) Smaller arcs are done with lines
+  #define ARC_BLOCK_MAX_RADIUS 16384        // (steps) Larger arcs lose precision in the fixed-point rotation
+
+  /**
+   * An XY arc executed by the stepper as a single block.
+   * Each step event turns the radius vector by a fixed angle using three
+   * shears (x -= a*y; y += b*x; x -= a*y). Every shear has a determinant
+   * of exactly 1, so rounding can't make the radius grow or shrink over
+   * a long arc the way a plain rotation matrix would.
+   */
+  typedef struct {
+    xy_long_t start,                        // Radius vector at the start of the block (steps, ARC_POS_FRAC)
+              correction,                   // Per-event drift to land exactly on the target (steps, ARC_POS_FRAC)
+              end;                          // Total X/Y steps from the start to the end of the arc
+    int32_t a, b;                           // Shear coefficients tan(φ/2) and sin(φ) (ARC_COEFF_FRAC)
+  } arc_block_t;
+
+#endif
+
 #if ENABLED(LASER_POWER_INLINE)
 
   typedef struct {
@@ -206,6 +253,10 @@ typedef struct block_t {
     page_idx_t page_idx;                    // Page index used for direct stepping
   #endif
 
+  #if ENABLED(ARC_BLOCKS)
+    arc_block_t arc;                        // Circle interpolator setup for arc blocks
+  #endif
+
   #if HAS_CUTTER
     cutter_power_t cutter_power;            // Power level for Spindle, Laser, etc.
   #endif
@@ -222,10 +273,14 @@ typedef struct block_t {
     uint32_t segment_time_us;
   #endif
 
-  #if ENABLED(POWER_LOSS_RECOVERY)
+  #if EITHER(POWER_LOSS_RECOVERY, PRINT_TIME_ESTIMATE)
     uint32_t sdpos;
   #endif
 
+  #if ENABLED(PRINT_TIME_ESTIMATE)
+    uint32_t move_time_us;                  // Time to run the whole trapezoid
+  #endif
+
   #if ENABLED(LASER_POWER_INLINE)
     block_laser_t laser;
   #endif
@@ -429,6 +484,19 @@ class Planner {
      */
     static uint32_t cutoff_long;
 
+    #if ENABLED(ARC_BLOCKS)
+      /**
+       * The arc being added by buffer_arc(), for _populate_block() to pick up
+       */
+      typedef struct {
+        arc_block_t block;
+        uint32_t events;                  // Step events for the whole arc
+        xy_float_t start_dir, end_dir;    // XY tangents (unit length) at the ends of the arc
+        float flat_mm;                    // Length of the arc in XY
+      } arc_plan_t;
+      static const arc_plan_t *arc_plan;
+    #endif
+
     #if ENABLED(ENABLE_LEVELING_FADE_HEIGHT)
       static float last_fade_z;
     #endif
@@ -743,6 +811,15 @@ class Planner {
         , fr_mm_s, extruder, millimeters);
     }
 
+    #if IS_KINEMATIC
+      // Add a segment to the buffer with its kinematics already done
+      static bool buffer_kinematic(const xyze_pos_t &cart, const abc_pos_t &joints, const float &e, const feedRate_t &fr_mm_s, const uint8_t extruder, const float millimeters
+        #if ENABLED(SCARA_FEEDRATE_SCALING)
+          , const float &inv_duration
+        #endif
+      );
+    #endif
+
   public:
 
     /**
@@ -774,10 +851,45 @@ class Planner {
       );
     }
 
+    #if IS_KINEMATIC
+      /**
+       * Add a run of segments to the buffer, working out the
+       * kinematics for all of them in one pass.
+       *
+       *  cart   - cartesian targets of the segments
+       *  count  - number of segments (up to KINEMATIC_BATCH_SIZE)
+       *  others - the same as buffer_line, for every segment
+       *
+       * Return the number of segments added. Fewer than 'count'
+       * means the buffer is being cleaned.
+       */
+      static uint8_t buffer_lines(const xyze_pos_t cart[], const uint8_t count, const feedRate_t &fr_mm_s, const uint8_t extruder, const float millimeters
+        #if ENABLED(SCARA_FEEDRATE_SCALING)
+          , const float &inv_duration
+        #endif
+      );
+    #endif
+
     #if ENABLED(DIRECT_STEPPING)
       static void buffer_page(const page_idx_t page_idx, const uint8_t extruder, const uint16_t num_steps);
     #endif
 
+    #if ENABLED(ARC_BLOCKS)
+      /**
+       * Add an XY arc (with optional helical Z and E) to the buffer as a single block.
+       * Return 'false' if the arc can't be a single block and should be split into lines.
+       *
+       *  cart           - target position in mm
+       *  center         - center of the arc in mm
+       *  angular_travel - signed angle to turn (radians, CCW positive)
+       *  millimeters    - length of the arc, including any helix
+       *  fr_mm_s        - (target) speed of the move (mm/s)
+       *  extruder       - target extruder
+       */
+      static bool buffer_arc(const xyze_pos_t &cart, const xy_pos_t &center, const float &angular_travel,
+                             const float &millimeters, feedRate_t fr_mm_s, const uint8_t extruder);
+    #endif
+
     /**
      * Set the planner.position and individual stepper positions.
      * Used by G92, G28, G29, and other procedures.
@@ -835,6 +947,25 @@ class Planner {
     // Triggered position of an axis in mm (not core-savvy)
     static float triggered_position_mm(const AxisEnum axis);
 
+    #if HAS_SEGMENT_GENERATOR
+      /**
+       * A curve (G2/G3/G5) fed to the planner a few segments at a time.
+       * The generator buffers segments while there are free blocks and
+       * returns false once the curve is done. Until then no more commands
+       * are run, but the main loop keeps reading serial and SD.
+       */
+      typedef bool (*segment_generator_t)();
+      static segment_generator_t segment_generator;
+
+      static void start_segments(const segment_generator_t gen) { segment_generator = gen; run_segment_generator(); }
+
+      // Buffer more segments, if there's room. True while the curve is unfinished.
+      static bool run_segment_generator();
+
+      // Buffer the rest of the curve, waiting for free blocks
+      static void finish_segments() { while (run_segment_generator()) idle(); }
+    #endif
+
     // Block until all buffered steps are executed / cleaned
     static void synchronize();
 
@@ -945,10 +1076,10 @@ class Planner {
     static void reverse_pass_kernel(block_t* const current, const block_t * const next);
     static void forward_pass_kernel(const block_t * const previous, block_t* const current, uint8_t block_index);
 
-    static void reverse_pass();
-    static void forward_pass();
+    static uint8_t reverse_pass();
+    static void forward_pass(const uint8_t first);
 
-    static void recalculate_trapezoids();
+    static void recalculate_trapezoids(const uint8_t first);
 
     static void recalculate();
 
@@ -33,12 +33,8 @@
 
 #include "planner.h"
 #include "motion.h"
-#include "temperature.h"
 
-#include "../MarlinCore.h"
-#include "../gcode/queue.h"
-
-// See the meaning in the documentation of cubic_b_spline().
+// See the meaning in the documentation of bezier_segments().
 #define MIN_STEP 0.002f
 #define MAX_STEP 0.1f
 #define SIGMA 0.1f
@@ -67,6 +63,16 @@ static inline float eval_bezier(const float &a, const float &b, const float &c,
  */
 static inline float dist1(const float &x1, const float &y1, const float &x2, const float &y2) { return ABS(x1 - x2) + ABS(y1 - y2); }
 
+// The curve being buffered
+static struct {
+  xyze_pos_t position,    // Start of the curve
+             target,      // End of the curve
+             bez_target;  // The last segment
+  xy_pos_t first, second; // Absolute control points
+  feedRate_t scaled_fr_mm_s;
+  float t, step;
+} bez;
+
 /**
  * The algorithm for computing the step is loosely based on the one in Kig
  * (See https://sources.debian.net/src/kig/4:15.08.3-1/misc/kigpainter.cpp/#L759)
@@ -105,31 +111,17 @@ static inline float dist1(const float &x1, const float &y1, const float &x2, con
  * estimates; however, given the improbability of such configurations,
  * the mitigation offered by MIN_STEP and the small computational
  * power available on Arduino, I think it is not wise to implement it.
+ *
+ * Segments are buffered while the planner has room. Return false when
+ * the curve is done.
  */
-void cubic_b_spline(
-  const xyze_pos_t &position,       // current position
-  const xyze_pos_t &target,         // target position
-  const xy_pos_t (&offsets)[2],     // a pair of offsets
-  const feedRate_t &scaled_fr_mm_s, // mm/s scaled by feedrate %
-  const uint8_t extruder
-) {
-  // Absolute first and second control points are recovered.
-  const xy_pos_t first = position + offsets[0], second = target + offsets[1];
-
-  xyze_pos_t bez_target;
-  bez_target.set(position.x, position.y);
-  float step = MAX_STEP;
+static bool bezier_segments() {
+  const xyze_pos_t &position = bez.position, &target = bez.target;
+  const xy_pos_t &first = bez.first, &second = bez.second;
+  xyze_pos_t &bez_target = bez.bez_target;
+  float &t = bez.t, &step = bez.step;
 
-  millis_t next_idle_ms = millis() + 200UL;
-
-  for (float t = 0; t < 1;) {
-
-    thermalManager.manage_heater();
-    millis_t now = millis();
-    if (ELAPSED(now, next_idle_ms)) {
-      next_idle_ms = now + 200UL;
-      idle();
-    }
+  while (t < 1 && planner.moves_free()) {
 
     // First try to reduce the step in order to make it sufficiently
     // close to a linear interpolation.
@@ -197,9 +189,35 @@ void cubic_b_spline(
       const xyze_pos_t &pos = bez_target;
     #endif
 
-    if (!planner.buffer_line(pos, scaled_fr_mm_s, active_extruder, step))
-      break;
+    if (!planner.buffer_line(pos, bez.scaled_fr_mm_s, active_extruder, step))
+      return false;
   }
+  return t < 1;
+}
+
+/**
+ * Set up the curve and start buffering its segments.
+ * planner.segment_generator buffers the rest.
+ */
+void cubic_b_spline(
+  const xyze_pos_t &position,       // current position
+  const xyze_pos_t &target,         // target position
+  const xy_pos_t (&offsets)[2],     // a pair of offsets
+  const feedRate_t &scaled_fr_mm_s, // mm/s scaled by feedrate %
+  const uint8_t extruder
+) {
+  bez.position = position;
+  bez.target = target;
+  // Absolute first and second control points are recovered.
+  bez.first = position + offsets[0];
+  bez.second = target + offsets[1];
+  bez.scaled_fr_mm_s = scaled_fr_mm_s;
+
+  bez.bez_target.set(position.x, position.y);
+  bez.t = 0;
+  bez.step = MAX_STEP;
+
+  planner.start_segments(bezier_segments);
 }
 
 #endif // BEZIER_CURVE_SUPPORT
@@ -94,11 +94,11 @@ void forward_kinematics_SCARA(const float &a, const float &b) {
   //*/
 }
 
-void inverse_kinematics(const xyz_pos_t &raw) {
+static FORCE_INLINE void scara_ik(const xyz_pos_t &raw, abc_pos_t &joints) {
 
   #if ENABLED(MORGAN_SCARA)
     /**
-     * Morgan SCARA Inverse Kinematics. Results in 'delta'.
+     * Morgan SCARA Inverse Kinematics. Results in 'joints'.
      *
      * See https://reprap.org/forum/read.php?185,283327
      *
@@ -130,11 +130,11 @@ void inverse_kinematics(const xyz_pos_t &raw) {
     // Angle of Arm2
     PSI = ATAN2(S2, C2);
 
-    delta.set(DEGREES(THETA), DEGREES(THETA + PSI), raw.z);
+    joints.set(DEGREES(THETA), DEGREES(THETA + PSI), raw.z);
 
     /*
       DEBUG_POS("SCARA IK", raw);
-      DEBUG_POS("SCARA IK", delta);
+      DEBUG_POS("SCARA IK", joints);
       SERIAL_ECHOLNPAIR("  SCARA (x,y) ", sx, ",", sy, " C2=", C2, " S2=", S2, " Theta=", THETA, " Phi=", PHI);
     //*/
 
@@ -145,17 +145,57 @@ void inverse_kinematics(const xyz_pos_t &raw) {
                 THETA1 = THETA3 + ACOS((sq(c) + sq(L1) - sq(L2)) / (2.0f * c * L1)),
                 THETA2 = THETA3 - ACOS((sq(c) + sq(L2) - sq(L1)) / (2.0f * c * L2));
 
-    delta.set(DEGREES(THETA1), DEGREES(THETA2), raw.z);
+    joints.set(DEGREES(THETA1), DEGREES(THETA2), raw.z);
 
     /*
       DEBUG_POS("SCARA IK", raw);
-      DEBUG_POS("SCARA IK", delta);
+      DEBUG_POS("SCARA IK", joints);
       SERIAL_ECHOLNPAIR("  SCARA (x,y) ", x, ",", y," Theta1=", THETA1, " Theta2=", THETA2);
     //*/
 
   #endif // MP_SCARA
 }
 
+void inverse_kinematics(const xyz_pos_t &raw) { scara_ik(raw, delta); }
+
+void inverse_kinematics(const xyze_pos_t raw[], abc_pos_t joints[], const uint8_t count) {
+  LOOP_L_N(i, count) scara_ik(raw[i], joints[i]);
+}
+
+#ifdef KINEMATIC_SEGMENT_TOLERANCE
+
+  // Angle difference folded into -180°..180°
+  static inline float fold_degrees(const float d) { return d - 360.0f * FLOOR((d + 180.0f) / 360.0f); }
+
+  // How far the nozzle strays at m when the arms step in a straight line from a to b.
+  // Arm 1 swings the whole of arm 2 and arm 2 swings the nozzle.
+  static float scara_stray(const abc_pos_t &a, const abc_pos_t &m, const abc_pos_t &b) {
+    const float da = fold_degrees(m.a - a.a) - fold_degrees(b.a - a.a) * 0.5f,
+                db = fold_degrees(m.b - a.b) - fold_degrees(b.b - a.b) * 0.5f;
+    return RADIANS(L1 * ABS(da) + L2 * ABS(db));
+  }
+
+  /**
+   * Get the arm angles at the ends and quarter points of the move. A straight
+   * step over 1/n of the move strays about 1/n² as much as one over the whole
+   * move, so also scale up the stray of each half to catch moves that bend
+   * mostly at one end (e.g., passing near the shoulder).
+   */
+  float kinematic_segments(const xy_pos_t &start, const xy_pos_t &end) {
+    const xy_pos_t step = (end - start) * 0.25f;
+    abc_pos_t q[5];
+    xyz_pos_t pos = { start.x, start.y, 0 };
+    LOOP_L_N(i, 5) {
+      scara_ik(pos, q[i]);
+      pos += step;
+    }
+
+    const float stray = _MAX(scara_stray(q[0], q[2], q[4]), 4 * _MAX(scara_stray(q[0], q[1], q[2]), scara_stray(q[2], q[3], q[4])));
+    return SQRT(stray * 1000.0f / (KINEMATIC_SEGMENT_TOLERANCE));
+  }
+
+#endif
+
 void scara_report_positions() {
   SERIAL_ECHOLNPAIR("SCARA Theta:", planner.get_axis_position_degrees(A_AXIS), "  Psi+Theta:", planner.get_axis_position_degrees(B_AXIS));
   SERIAL_EOL();
@@ -37,6 +37,15 @@ float constexpr L1 = SCARA_LINKAGE_1, L2 = SCARA_LINKAGE_2,
 void scara_set_axis_is_at_home(const AxisEnum axis);
 
 void inverse_kinematics(const xyz_pos_t &raw);
+void inverse_kinematics(const xyze_pos_t raw[], abc_pos_t joints[], const uint8_t count);
 void forward_kinematics_SCARA(const float &a, const float &b);
 
 void scara_report_positions();
+
+#ifdef KINEMATIC_SEGMENT_TOLERANCE
+  /**
+   * Number of segments (not rounded) needed to keep the
+   * arms within KINEMATIC_SEGMENT_TOLERANCE of the path
+   */
+  float kinematic_segments(const xy_pos_t &start, const xy_pos_t &end);
+#endif
@@ -132,6 +132,20 @@ Stepper stepper; // Singleton
   #include "../feature/powerloss.h"
 #endif
 
+#if ENABLED(PRINT_TIME_ESTIMATE)
+  #include "../feature/time_estimate.h"
+#endif
+
+#if ENABLED(INPUT_SHAPING)
+  #include "../feature/input_shaping.h"
+#endif
+
+#if ENABLED(STEPPER_ISR_PROFILER)
+  #include "../feature/stepper_profiler.h"
+#else
+  #define PROFILE_PHASE(P, V) V
+#endif
+
 #if HAS_CUTTER
   #include "../feature/spindle_laser.h"
 #endif
@@ -231,6 +245,11 @@ uint32_t Stepper::advance_divisor = 0,
   page_step_state_t Stepper::page_step_state;
 #endif
 
+#if ENABLED(ARC_BLOCKS)
+  xy_long_t Stepper::arc_vec, Stepper::arc_drift, Stepper::arc_steps;
+  uint32_t Stepper::arc_events;
+#endif
+
 int32_t Stepper::ticks_nominal = -1;
 #if DISABLED(S_CURVE_ACCELERATION)
   uint32_t Stepper::acc_step_rate; // needed for deceleration start point
@@ -458,13 +477,22 @@ void Stepper::set_directions() {
 
   DIR_WAIT_BEFORE();
 
+  // An input shaper sets the DIR pin of its axis as it steps
+  #if ENABLED(INPUT_SHAPING)
+    #define SHAPED_DIR(A) (_AXIS(A) < SHAPING_AXES && input_shaping.axis[_AXIS(A)].enabled)
+  #else
+    #define SHAPED_DIR(A) false
+  #endif
+
   #define SET_STEP_DIR(A)                       \
     if (motor_direction(_AXIS(A))) {            \
-      A##_APPLY_DIR(INVERT_##A##_DIR, false);   \
+      if (!SHAPED_DIR(A))                       \
+        A##_APPLY_DIR(INVERT_##A##_DIR, false); \
       count_direction[_AXIS(A)] = -1;           \
     }                                           \
     else {                                      \
-      A##_APPLY_DIR(!INVERT_##A##_DIR, false);  \
+      if (!SHAPED_DIR(A))                       \
+        A##_APPLY_DIR(!INVERT_##A##_DIR, false);\
       count_direction[_AXIS(A)] = 1;            \
     }
 
@@ -1355,6 +1383,10 @@ void Stepper::isr() {
 
   static uint32_t nextMainISR = 0;  // Interval until the next main Stepper Pulse phase (0 = Now)
 
+  #if ENABLED(INPUT_SHAPING)
+    static uint32_t nextShapingISR = SHAPING_NEVER; // Interval until the next X/Y shaped impulse
+  #endif
+
   #ifndef __AVR__
     // Disable interrupts, to avoid ISR preemption while we reprogram the period
     // (AVR enters the ISR with global interrupts disabled, so no need to do it here)
@@ -1366,6 +1398,8 @@ void Stepper::isr() {
   // periods to big periods are respected and the timer does not reset to 0
   HAL_timer_set_compare(STEP_TIMER_NUM, hal_timer_t(HAL_TIMER_TYPE_MAX));
 
+  TERN_(STEPPER_ISR_PROFILER, const hal_timer_t isr_start = stepper_profiler.now());
+
   // Count of ticks for the next ISR
   hal_timer_t next_isr_ticks = 0;
 
@@ -1378,20 +1412,30 @@ void Stepper::isr() {
     // Enable ISRs to reduce USART processing latency
     ENABLE_ISRS();
 
-    if (!nextMainISR) pulse_phase_isr();                            // 0 = Do coordinated axes Stepper pulses
+    #if ENABLED(INPUT_SHAPING)
+      if (!nextShapingISR)                                          // 0 = Do delayed X/Y impulses
+        PROFILE_PHASE(SHAPING, shaping_isr());
+
+      // Hold back the coordinated pulses until the shapers have room for their steps
+      if (!nextMainISR && !input_shaping.has_room(steps_per_isr))
+        nextMainISR = input_shaping.next();
+    #endif
+
+    if (!nextMainISR) PROFILE_PHASE(PULSE, pulse_phase_isr());      // 0 = Do coordinated axes Stepper pulses
 
     #if ENABLED(LIN_ADVANCE)
-      if (!nextAdvanceISR) nextAdvanceISR = advance_isr();          // 0 = Do Linear Advance E Stepper pulses
+      if (!nextAdvanceISR)                                          // 0 = Do Linear Advance E Stepper pulses
+        PROFILE_PHASE(ADVANCE, nextAdvanceISR = advance_isr());
     #endif
 
     #if ENABLED(INTEGRATED_BABYSTEPPING)
       const bool is_babystep = (nextBabystepISR == 0);              // 0 = Do Babystepping (XY)Z pulses
-      if (is_babystep) nextBabystepISR = babystepping_isr();
+      if (is_babystep) PROFILE_PHASE(BABYSTEP, nextBabystepISR = babystepping_isr());
     #endif
 
     // ^== Time critical. NOTHING besides pulse generation should be above here!!!
 
-    if (!nextMainISR) nextMainISR = block_phase_isr();  // Manage acc/deceleration, get next block
+    if (!nextMainISR) PROFILE_PHASE(BLOCK, nextMainISR = block_phase_isr()); // Manage acc/deceleration, get next block
 
     #if ENABLED(INTEGRATED_BABYSTEPPING)
       if (is_babystep)                                  // Avoid ANY stepping too soon after baby-stepping
@@ -1401,6 +1445,8 @@ void Stepper::isr() {
         NOLESS(nextBabystepISR, nextMainISR / 2);       // TODO: Only look at axes enabled for baby-stepping
     #endif
 
+    TERN_(INPUT_SHAPING, nextShapingISR = input_shaping.next()); // Steps may have been queued
+
     // Get the interval to the next ISR call
     const uint32_t interval = _MIN(
       nextMainISR                                       // Time until the next Pulse / Block phase
@@ -1410,6 +1456,9 @@ void Stepper::isr() {
       #if ENABLED(INTEGRATED_BABYSTEPPING)
         , nextBabystepISR                               // Come back early for Babystepping?
       #endif
+      #if ENABLED(INPUT_SHAPING)
+        , nextShapingISR                                // Come back early for a shaped impulse?
+      #endif
       , uint32_t(HAL_TIMER_TYPE_MAX)                    // Come back in a very long time
     );
 
@@ -1430,6 +1479,11 @@ void Stepper::isr() {
       if (nextBabystepISR != BABYSTEP_NEVER) nextBabystepISR -= interval;
     #endif
 
+    #if ENABLED(INPUT_SHAPING)
+      if (nextShapingISR != SHAPING_NEVER) nextShapingISR -= interval;
+      InputShaping::now += interval;
+    #endif
+
     /**
      * This needs to avoid a race-condition caused by interleaving
      * of interrupts required by both the LA and Stepper algorithms.
@@ -1487,7 +1541,12 @@ void Stepper::isr() {
      * loop to 10 iterations. Beyond that, there's no way to ensure correct pulse
      * timing, since the MCU isn't fast enough.
      */
-    if (!--max_loops) next_isr_ticks = min_ticks;
+    TERN_(STEPPER_ISR_PROFILER, stepper_profiler.deadline(next_isr_ticks, min_ticks));
+
+    if (!--max_loops) {
+      next_isr_ticks = min_ticks;
+      TERN_(STEPPER_ISR_PROFILER, stepper_profiler.exhausted());
+    }
 
     // Advance pulses if not enough time to wait for the next ISR
   } while (next_isr_ticks < min_ticks);
@@ -1495,6 +1554,8 @@ void Stepper::isr() {
   // Now 'next_isr_ticks' contains the period to the next Stepper ISR - And we are
   // sure that the time has not arrived yet - Warrantied by the scheduler
 
+  TERN_(STEPPER_ISR_PROFILER, stepper_profiler.isr_done(isr_start));
+
   // Set the next ISR to fire at the proper time
   HAL_timer_set_compare(STEP_TIMER_NUM, hal_timer_t(next_isr_ticks));
 
@@ -1569,9 +1630,43 @@ void Stepper::pulse_phase_isr() {
       } \
     }while(0)
 
+    #if ENABLED(INPUT_SHAPING)
+
+      // Take a step off the residual of a shaper, turning its DIR pin as needed
+      #define SHAPED_STEP(AXIS) do{ \
+        AxisShaper &shaper = input_shaping.axis[_AXIS(AXIS)]; \
+        const int8_t d = shaper.step_due(); \
+        step_needed[_AXIS(AXIS)] = !!d; \
+        if (d) { \
+          if ((d < 0) != shaper.reversed) { \
+            shaper.reversed = (d < 0); \
+            DIR_WAIT_BEFORE(); \
+            AXIS##_APPLY_DIR(shaper.reversed ? INVERT_##AXIS##_DIR : !INVERT_##AXIS##_DIR, false); \
+            DIR_WAIT_AFTER(); \
+          } \
+          shaper.residual -= d * (SHAPING_UNIT); \
+        } \
+      }while(0)
+
+      #define SHAPING_PULSE_PREP(AXIS) do{ \
+        if (input_shaping.axis[_AXIS(AXIS)].enabled) { \
+          if (step_needed[_AXIS(AXIS)]) { \
+            const bool reverse = count_direction[_AXIS(AXIS)] < 0; \
+            input_shaping.axis[_AXIS(AXIS)].input(InputShaping::now, reverse); \
+            TERN_(HAL_SHAPING_TRACE, HAL_shaping_trace(_AXIS(AXIS), reverse)); \
+          } \
+          SHAPED_STEP(AXIS); \
+        } \
+      }while(0)
+
+    #endif
+
     // Direct Stepping page?
     const bool is_page = IS_PAGE(current_block);
 
+    // Arc block?
+    const bool is_arc = IS_ARC(current_block);
+
     #if ENABLED(DIRECT_STEPPING)
 
       if (is_page) {
@@ -1681,13 +1776,54 @@ void Stepper::pulse_phase_isr() {
 
     #endif // DIRECT_STEPPING
 
+    #if ENABLED(ARC_BLOCKS)
+
+      if (is_arc) {
+        const arc_block_t &arc = current_block->arc;
+
+        // Turn the radius vector by one event with three shears
+        #define ARC_SHEAR(V, C) ((int64_t(C) * (V) + _BV32(ARC_COEFF_FRAC - 1)) >> (ARC_COEFF_FRAC))
+        arc_vec.x -= ARC_SHEAR(arc_vec.y, arc.a);
+        arc_vec.y += ARC_SHEAR(arc_vec.x, arc.b);
+        arc_vec.x -= ARC_SHEAR(arc_vec.y, arc.a);
+        arc_drift += arc.correction;
+
+        // Head for the nearest whole step, and exactly the target on the last event
+        #define ARC_GOAL(A) ((arc_vec.A + arc_drift.A - arc.start.A + _BV32(ARC_POS_FRAC - 1)) >> (ARC_POS_FRAC))
+        const bool last = !--arc_events;
+        const int32_t dx = (last ? arc.end.x : ARC_GOAL(x)) - arc_steps.x,
+                      dy = (last ? arc.end.y : ARC_GOAL(y)) - arc_steps.y;
+
+        // X and Y reverse as the arc goes around
+        uint8_t dm = last_direction_bits;
+        if (dx) { if (dx < 0) SBI(dm, X_AXIS); else CBI(dm, X_AXIS); }
+        if (dy) { if (dy < 0) SBI(dm, Y_AXIS); else CBI(dm, Y_AXIS); }
+        if (dm != last_direction_bits) {
+          last_direction_bits = dm;
+          set_directions();
+        }
+
+        #define ARC_PULSE_PREP(AXIS, D) do{ \
+          step_needed[_AXIS(AXIS)] = !!(D); \
+          if (D) { \
+            count_position[_AXIS(AXIS)] += count_direction[_AXIS(AXIS)]; \
+            arc_steps[_AXIS(AXIS)] += count_direction[_AXIS(AXIS)]; \
+          } \
+        }while(0)
+
+        ARC_PULSE_PREP(X, dx);
+        ARC_PULSE_PREP(Y, dy);
+      }
+
+    #endif // ARC_BLOCKS
+
     if (!is_page) {
       // Determine if pulses are needed
       #if HAS_X_STEP
-        PULSE_PREP(X);
+        if (!is_arc) PULSE_PREP(X);
       #endif
       #if HAS_Y_STEP
-        PULSE_PREP(Y);
+        if (!is_arc) PULSE_PREP(Y);
       #endif
       #if HAS_Z_STEP
         PULSE_PREP(Z);
@@ -1710,6 +1846,12 @@ void Stepper::pulse_phase_isr() {
       #endif
     }
 
+    #if ENABLED(INPUT_SHAPING)
+      // Queue the X/Y steps and send what the shapers make of them now
+      SHAPING_PULSE_PREP(X);
+      SHAPING_PULSE_PREP(Y);
+    #endif
+
     #if ISR_MULTI_STEPS
       if (firstStep)
         firstStep = false;
@@ -2003,6 +2145,7 @@ uint32_t Stepper::block_phase_isr() {
       #endif
 
       TERN_(POWER_LOSS_RECOVERY, recovery.info.sdpos = current_block->sdpos);
+      TERN_(PRINT_TIME_ESTIMATE, time_estimate.block_started(current_block->move_time_us, current_block->sdpos));
 
       #if ENABLED(DIRECT_STEPPING)
         if (IS_PAGE(current_block)) {
@@ -2021,6 +2164,15 @@ uint32_t Stepper::block_phase_isr() {
         }
       #endif
 
+      #if ENABLED(ARC_BLOCKS)
+        if (IS_ARC(current_block)) {
+          arc_vec = current_block->arc.start;
+          arc_drift.reset();
+          arc_steps.reset();
+          arc_events = current_block->step_event_count;
+        }
+      #endif
+
       // Flag all moving axes for proper endstop handling
 
       #if IS_CORE
@@ -2100,7 +2252,9 @@ uint32_t Stepper::block_phase_isr() {
         uint8_t oversampling = 0;                           // Assume no axis smoothing (via oversampling)
         // Decide if axis smoothing is possible
         uint32_t max_rate = current_block->nominal_rate;    // Get the step event rate
-        while (max_rate < MIN_STEP_ISR_FREQUENCY) {         // As long as more ISRs are possible...
+        while (max_rate < MIN_STEP_ISR_FREQUENCY            // As long as more ISRs are possible...
+          && !IS_ARC(current_block)                         // ...and it's not an arc (which turns once per event)...
+        ) {
           max_rate <<= 1;                                   // Try to double the rate
           if (max_rate < MIN_STEP_ISR_FREQUENCY)            // Don't exceed the estimated ISR limit
             ++oversampling;                                 // Increase the oversampling (used for left-shift)
@@ -2353,6 +2507,43 @@ uint32_t Stepper::block_phase_isr() {
 
 #endif
 
+#if ENABLED(INPUT_SHAPING)
+
+  // Timer interrupt for the delayed impulses of the X/Y input shapers
+  void Stepper::shaping_isr() {
+    input_shaping.echoes();
+
+    #if ISR_MULTI_STEPS
+      USING_TIMED_PULSE();
+    #endif
+    xyze_bool_t step_needed{0};
+
+    for (;;) {
+      SHAPED_STEP(X);
+      SHAPED_STEP(Y);
+      if (!step_needed.x && !step_needed.y) break;
+
+      PULSE_START(X);
+      PULSE_START(Y);
+
+      #if ISR_MULTI_STEPS
+        START_HIGH_PULSE();
+        AWAIT_HIGH_PULSE();
+      #endif
+
+      PULSE_STOP(X);
+      PULSE_STOP(Y);
+
+      // Keep the pin low for long enough before the next step, here or in the pulse phase
+      #if ISR_MULTI_STEPS
+        START_LOW_PULSE();
+        AWAIT_LOW_PULSE();
+      #endif
+    }
+  }
+
+#endif
+
 // Check if the given block is busy or not - Must not be called from ISR contexts
 // The current_block could change in the middle of the read by an Stepper ISR, so
 // we must explicitly prevent that!
@@ -2590,6 +2781,8 @@ void Stepper::init() {
 
   set_directions();
 
+  TERN_(INPUT_SHAPING, input_shaping.refresh()); // Shapers take over the X/Y DIR pins from here
+
   #if HAS_DIGIPOTSS || HAS_MOTOR_CURRENT_PWM
     TERN_(HAS_MOTOR_CURRENT_PWM, initialized = true);
     digipot_init();
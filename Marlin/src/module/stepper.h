@@ -339,6 +339,13 @@ class Stepper {
       static page_step_state_t page_step_state;
     #endif
 
+    #if ENABLED(ARC_BLOCKS)
+      static xy_long_t arc_vec,     // Radius vector turned by the circle interpolator
+                       arc_drift,   // Correction applied so far
+                       arc_steps;   // X/Y steps taken so far
+      static uint32_t arc_events;   // Step events left in the arc
+    #endif
+
     static int32_t ticks_nominal;
     #if DISABLED(S_CURVE_ACCELERATION)
       static uint32_t acc_step_rate; // needed for deceleration start point
@@ -405,6 +412,11 @@ class Stepper {
       FORCE_INLINE static void initiateLA() { nextAdvanceISR = 0; }
     #endif
 
+    #if ENABLED(INPUT_SHAPING)
+      // The Input Shaping ISR phase
+      static void shaping_isr();
+    #endif
+
     #if ENABLED(INTEGRATED_BABYSTEPPING)
       // The Babystepping ISR phase
       static uint32_t babystepping_isr();
@@ -254,14 +254,34 @@ const char str_t_thermal_runaway[] PROGMEM = STR_T_THERMAL_RUNAWAY,
   hotend_idle_t Temperature::hotend_idle[HOTENDS]; // = { { 0 } }
 #endif
 
+#define TEMPDIR(N) ((HEATER_##N##_RAW_LO_TEMP) < (HEATER_##N##_RAW_HI_TEMP) ? 1 : -1)
+
+// Raw limits from a thermistor table, the same as stepping through the ADC range
+#define _TT_RAW_MIN(N,TBL,T) thermistor_raw_limit(TBL##_TEMPTABLE, TBL##_TEMPTABLE_LEN, HEATER_##N##_RAW_LO_TEMP, TEMPDIR(N) * (OVERSAMPLENR), T, true)
+#define _TT_RAW_MAX(N,TBL,T) thermistor_raw_limit(TBL##_TEMPTABLE, TBL##_TEMPTABLE_LEN, HEATER_##N##_RAW_HI_TEMP, -TEMPDIR(N) * (OVERSAMPLENR), T, false)
+
 #if HAS_HEATED_BED
   bed_info_t Temperature::temp_bed; // = { 0 }
-  // Init min and max temp with extreme values to prevent false errors during startup
+  // Init min and max temp with extreme values to prevent false errors during startup,
+  // or get them from the thermistor table
+  #define BED_TABLE_LIMITS (ENABLED(HEATER_BED_USES_THERMISTOR) && DISABLED(HEATER_BED_USER_THERMISTOR))
   #ifdef BED_MINTEMP
-    int16_t Temperature::mintemp_raw_BED = HEATER_BED_RAW_LO_TEMP;
+    int16_t Temperature::mintemp_raw_BED =
+      #if BED_TABLE_LIMITS
+        _TT_RAW_MIN(BED, BED, BED_MINTEMP)
+      #else
+        HEATER_BED_RAW_LO_TEMP
+      #endif
+    ;
   #endif
   #ifdef BED_MAXTEMP
-    int16_t Temperature::maxtemp_raw_BED = HEATER_BED_RAW_HI_TEMP;
+    int16_t Temperature::maxtemp_raw_BED =
+      #if BED_TABLE_LIMITS
+        _TT_RAW_MAX(BED, BED, BED_MAXTEMP)
+      #else
+        HEATER_BED_RAW_HI_TEMP
+      #endif
+    ;
   #endif
   TERN_(WATCH_BED, bed_watch_t Temperature::watch_bed); // = { 0 }
   TERN(PIDTEMPBED,, millis_t Temperature::next_bed_check_ms);
@@ -271,11 +291,24 @@ const char str_t_thermal_runaway[] PROGMEM = STR_T_THERMAL_RUNAWAY,
 #if HAS_TEMP_CHAMBER
   chamber_info_t Temperature::temp_chamber; // = { 0 }
   #if HAS_HEATED_CHAMBER
+    #define CHAMBER_TABLE_LIMITS (ENABLED(HEATER_CHAMBER_USES_THERMISTOR) && DISABLED(HEATER_CHAMBER_USER_THERMISTOR))
     #ifdef CHAMBER_MINTEMP
-      int16_t Temperature::mintemp_raw_CHAMBER = HEATER_CHAMBER_RAW_LO_TEMP;
+      int16_t Temperature::mintemp_raw_CHAMBER =
+        #if CHAMBER_TABLE_LIMITS
+          _TT_RAW_MIN(CHAMBER, CHAMBER, CHAMBER_MINTEMP)
+        #else
+          HEATER_CHAMBER_RAW_LO_TEMP
+        #endif
+      ;
     #endif
     #ifdef CHAMBER_MAXTEMP
-      int16_t Temperature::maxtemp_raw_CHAMBER = HEATER_CHAMBER_RAW_HI_TEMP;
+      int16_t Temperature::maxtemp_raw_CHAMBER =
+        #if CHAMBER_TABLE_LIMITS
+          _TT_RAW_MAX(CHAMBER, CHAMBER, CHAMBER_MAXTEMP)
+        #else
+          HEATER_CHAMBER_RAW_HI_TEMP
+        #endif
+      ;
     #endif
     #if WATCH_CHAMBER
       chamber_watch_t Temperature::watch_chamber{0};
@@ -316,18 +349,137 @@ volatile bool Temperature::raw_temps_ready = false;
   lpq_ptr_t Temperature::lpq_ptr = 0;
 #endif
 
-#define TEMPDIR(N) ((HEATER_##N##_RAW_LO_TEMP) < (HEATER_##N##_RAW_HI_TEMP) ? 1 : -1)
-
 #if HAS_HOTEND
-  // Init mintemp and maxtemp with extreme values to prevent false errors during startup
-  constexpr temp_range_t sensor_heater_0 { HEATER_0_RAW_LO_TEMP, HEATER_0_RAW_HI_TEMP, 0, 16383 },
-                         sensor_heater_1 { HEATER_1_RAW_LO_TEMP, HEATER_1_RAW_HI_TEMP, 0, 16383 },
-                         sensor_heater_2 { HEATER_2_RAW_LO_TEMP, HEATER_2_RAW_HI_TEMP, 0, 16383 },
-                         sensor_heater_3 { HEATER_3_RAW_LO_TEMP, HEATER_3_RAW_HI_TEMP, 0, 16383 },
-                         sensor_heater_4 { HEATER_4_RAW_LO_TEMP, HEATER_4_RAW_HI_TEMP, 0, 16383 },
-                         sensor_heater_5 { HEATER_5_RAW_LO_TEMP, HEATER_5_RAW_HI_TEMP, 0, 16383 },
-                         sensor_heater_6 { HEATER_6_RAW_LO_TEMP, HEATER_6_RAW_HI_TEMP, 0, 16383 },
-                         sensor_heater_7 { HEATER_7_RAW_LO_TEMP, HEATER_7_RAW_HI_TEMP, 0, 16383 };
+  #define _MINMAX_TEST(N,M) (HOTENDS > N && THERMISTOR_HEATER_##N && THERMISTOR_HEATER_##N != 998 && THERMISTOR_HEATER_##N != 999 && defined(HEATER_##N##_##M##TEMP))
+
+  // Thermistor tables give the limits at compile time. User thermistors are set up by init().
+  #define _TT_MINMAX_TEST(N,M) (_MINMAX_TEST(N,M) && DISABLED(HEATER_##N##_USER_THERMISTOR))
+  #define _TT_TMIN(N) _MAX(HEATER_##N##_MINTEMP, HEATER_##N##_TEMPTABLE[HEATER_##N##_SENSOR_MINTEMP_IND].celsius)
+  #define _TT_TMAX(N) _MIN(HEATER_##N##_MAXTEMP, HEATER_##N##_TEMPTABLE[HEATER_##N##_SENSOR_MAXTEMP_IND].celsius - 1)
+
+  #if _TT_MINMAX_TEST(0, MIN)
+    #define HEATER_0_TMIN _TT_TMIN(0)
+    #define HEATER_0_RAW_MIN _TT_RAW_MIN(0, HEATER_0, HEATER_0_TMIN)
+  #else
+    #define HEATER_0_TMIN 0
+    #define HEATER_0_RAW_MIN HEATER_0_RAW_LO_TEMP
+  #endif
+  #if _TT_MINMAX_TEST(0, MAX)
+    #define HEATER_0_TMAX _TT_TMAX(0)
+    #define HEATER_0_RAW_MAX _TT_RAW_MAX(0, HEATER_0, HEATER_0_TMAX)
+  #else
+    #define HEATER_0_TMAX 16383
+    #define HEATER_0_RAW_MAX HEATER_0_RAW_HI_TEMP
+  #endif
+  #if _TT_MINMAX_TEST(1, MIN)
+    #define HEATER_1_TMIN _TT_TMIN(1)
+    #define HEATER_1_RAW_MIN _TT_RAW_MIN(1, HEATER_1, HEATER_1_TMIN)
+  #else
+    #define HEATER_1_TMIN 0
+    #define HEATER_1_RAW_MIN HEATER_1_RAW_LO_TEMP
+  #endif
+  #if _TT_MINMAX_TEST(1, MAX)
+    #define HEATER_1_TMAX _TT_TMAX(1)
+    #define HEATER_1_RAW_MAX _TT_RAW_MAX(1, HEATER_1, HEATER_1_TMAX)
+  #else
+    #define HEATER_1_TMAX 16383
+    #define HEATER_1_RAW_MAX HEATER_1_RAW_HI_TEMP
+  #endif
+  #if _TT_MINMAX_TEST(2, MIN)
+    #define HEATER_2_TMIN _TT_TMIN(2)
+    #define HEATER_2_RAW_MIN _TT_RAW_MIN(2, HEATER_2, HEATER_2_TMIN)
+  #else
+    #define HEATER_2_TMIN 0
+    #define HEATER_2_RAW_MIN HEATER_2_RAW_LO_TEMP
+  #endif
+  #if _TT_MINMAX_TEST(2, MAX)
+    #define HEATER_2_TMAX _TT_TMAX(2)
+    #define HEATER_2_RAW_MAX _TT_RAW_MAX(2, HEATER_2, HEATER_2_TMAX)
+  #else
+    #define HEATER_2_TMAX 16383
+    #define HEATER_2_RAW_MAX HEATER_2_RAW_HI_TEMP
+  #endif
+  #if _TT_MINMAX_TEST(3, MIN)
+    #define HEATER_3_TMIN _TT_TMIN(3)
+    #define HEATER_3_RAW_MIN _TT_RAW_MIN(3, HEATER_3, HEATER_3_TMIN)
+  #else
+    #define HEATER_3_TMIN 0
+    #define HEATER_3_RAW_MIN HEATER_3_RAW_LO_TEMP
+  #endif
+  #if _TT_MINMAX_TEST(3, MAX)
+    #define HEATER_3_TMAX _TT_TMAX(3)
+    #define HEATER_3_RAW_MAX _TT_RAW_MAX(3, HEATER_3, HEATER_3_TMAX)
+  #else
+    #define HEATER_3_TMAX 16383
+    #define HEATER_3_RAW_MAX HEATER_3_RAW_HI_TEMP
+  #endif
+  #if _TT_MINMAX_TEST(4, MIN)
+    #define HEATER_4_TMIN _TT_TMIN(4)
+    #define HEATER_4_RAW_MIN _TT_RAW_MIN(4, HEATER_4, HEATER_4_TMIN)
+  #else
+    #define HEATER_4_TMIN 0
+    #define HEATER_4_RAW_MIN HEATER_4_RAW_LO_TEMP
+  #endif
+  #if _TT_MINMAX_TEST(4, MAX)
+    #define HEATER_4_TMAX _TT_TMAX(4)
+    #define HEATER_4_RAW_MAX _TT_RAW_MAX(4, HEATER_4, HEATER_4_TMAX)
+  #else
+    #define HEATER_4_TMAX 16383
+    #define HEATER_4_RAW_MAX HEATER_4_RAW_HI_TEMP
+  #endif
+  #if _TT_MINMAX_TEST(5, MIN)
+    #define HEATER_5_TMIN _TT_TMIN(5)
+    #define HEATER_5_RAW_MIN _TT_RAW_MIN(5, HEATER_5, HEATER_5_TMIN)
+  #else
+    #define HEATER_5_TMIN 0
+    #define HEATER_5_RAW_MIN HEATER_5_RAW_LO_TEMP
+  #endif
+  #if _TT_MINMAX_TEST(5, MAX)
+    #define HEATER_5_TMAX _TT_TMAX(5)
+    #define HEATER_5_RAW_MAX _TT_RAW_MAX(5, HEATER_5, HEATER_5_TMAX)
+  #else
+    #define HEATER_5_TMAX 16383
+    #define HEATER_5_RAW_MAX HEATER_5_RAW_HI_TEMP
+  #endif
+  #if _TT_MINMAX_TEST(6, MIN)
+    #define HEATER_6_TMIN _TT_TMIN(6)
+    #define HEATER_6_RAW_MIN _TT_RAW_MIN(6, HEATER_6, HEATER_6_TMIN)
+  #else
+    #define HEATER_6_TMIN 0
+    #define HEATER_6_RAW_MIN HEATER_6_RAW_LO_TEMP
+  #endif
+  #if _TT_MINMAX_TEST(6, MAX)
+    #define HEATER_6_TMAX _TT_TMAX(6)
+    #define HEATER_6_RAW_MAX _TT_RAW_MAX(6, HEATER_6, HEATER_6_TMAX)
+  #else
+    #define HEATER_6_TMAX 16383
+    #define HEATER_6_RAW_MAX HEATER_6_RAW_HI_TEMP
+  #endif
+  #if _TT_MINMAX_TEST(7, MIN)
+    #define HEATER_7_TMIN _TT_TMIN(7)
+    #define HEATER_7_RAW_MIN _TT_RAW_MIN(7, HEATER_7, HEATER_7_TMIN)
+  #else
+    #define HEATER_7_TMIN 0
+    #define HEATER_7_RAW_MIN HEATER_7_RAW_LO_TEMP
+  #endif
+  #if _TT_MINMAX_TEST(7, MAX)
+    #define HEATER_7_TMAX _TT_TMAX(7)
+    #define HEATER_7_RAW_MAX _TT_RAW_MAX(7, HEATER_7, HEATER_7_TMAX)
+  #else
+    #define HEATER_7_TMAX 16383
+    #define HEATER_7_RAW_MAX HEATER_7_RAW_HI_TEMP
+  #endif
+
+  // Other sensors start with extreme values to prevent false errors during startup
+  #define _SENSOR_RANGE(N) { HEATER_##N##_RAW_MIN, HEATER_##N##_RAW_MAX, HEATER_##N##_TMIN, HEATER_##N##_TMAX }
+  constexpr temp_range_t sensor_heater_0 _SENSOR_RANGE(0),
+                         sensor_heater_1 _SENSOR_RANGE(1),
+                         sensor_heater_2 _SENSOR_RANGE(2),
+                         sensor_heater_3 _SENSOR_RANGE(3),
+                         sensor_heater_4 _SENSOR_RANGE(4),
+                         sensor_heater_5 _SENSOR_RANGE(5),
+                         sensor_heater_6 _SENSOR_RANGE(6),
+                         sensor_heater_7 _SENSOR_RANGE(7);
 
   temp_range_t Temperature::temp_range[HOTENDS] = ARRAY_BY_HOTENDS(sensor_heater_0, sensor_heater_1, sensor_heater_2, sensor_heater_3, sensor_heater_4, sensor_heater_5, sensor_heater_6, sensor_heater_7);
 #endif
@@ -1818,86 +1970,87 @@ void Temperature::init() {
 
   #if HAS_HOTEND
 
+    // Limits of user thermistors depend on the settings
     #define _TEMP_MIN_E(NR) do{ \
-      const int16_t tmin = _MAX(HEATER_ ##NR## _MINTEMP, TERN(HEATER_##NR##_USER_THERMISTOR, 0, (int16_t)pgm_read_word(&HEATER_ ##NR## _TEMPTABLE[HEATER_ ##NR## _SENSOR_MINTEMP_IND].celsius))); \
+      const int16_t tmin = _MAX(HEATER_ ##NR## _MINTEMP, 0); \
       temp_range[NR].mintemp = tmin; \
       while (analog_to_celsius_hotend(temp_range[NR].raw_min, NR) < tmin) \
         temp_range[NR].raw_min += TEMPDIR(NR) * (OVERSAMPLENR); \
     }while(0)
     #define _TEMP_MAX_E(NR) do{ \
-      const int16_t tmax = _MIN(HEATER_ ##NR## _MAXTEMP, TERN(HEATER_##NR##_USER_THERMISTOR, 2000, (int16_t)pgm_read_word(&HEATER_ ##NR## _TEMPTABLE[HEATER_ ##NR## _SENSOR_MAXTEMP_IND].celsius) - 1)); \
+      const int16_t tmax = _MIN(HEATER_ ##NR## _MAXTEMP, 2000); \
       temp_range[NR].maxtemp = tmax; \
       while (analog_to_celsius_hotend(temp_range[NR].raw_max, NR) > tmax) \
         temp_range[NR].raw_max -= TEMPDIR(NR) * (OVERSAMPLENR); \
     }while(0)
 
-    #define _MINMAX_TEST(N,M) (HOTENDS > N && THERMISTOR_HEATER_##N && THERMISTOR_HEATER_##N != 998 && THERMISTOR_HEATER_##N != 999 && defined(HEATER_##N##_##M##TEMP))
+    #define _USER_MINMAX_TEST(N,M) (_MINMAX_TEST(N,M) && ENABLED(HEATER_##N##_USER_THERMISTOR))
 
-    #if _MINMAX_TEST(0, MIN)
+    #if _USER_MINMAX_TEST(0, MIN)
       _TEMP_MIN_E(0);
     #endif
-    #if _MINMAX_TEST(0, MAX)
+    #if _USER_MINMAX_TEST(0, MAX)
       _TEMP_MAX_E(0);
     #endif
-    #if _MINMAX_TEST(1, MIN)
+    #if _USER_MINMAX_TEST(1, MIN)
       _TEMP_MIN_E(1);
     #endif
-    #if _MINMAX_TEST(1, MAX)
+    #if _USER_MINMAX_TEST(1, MAX)
       _TEMP_MAX_E(1);
     #endif
-    #if _MINMAX_TEST(2, MIN)
+    #if _USER_MINMAX_TEST(2, MIN)
       _TEMP_MIN_E(2);
     #endif
-    #if _MINMAX_TEST(2, MAX)
+    #if _USER_MINMAX_TEST(2, MAX)
       _TEMP_MAX_E(2);
     #endif
-    #if _MINMAX_TEST(3, MIN)
+    #if _USER_MINMAX_TEST(3, MIN)
       _TEMP_MIN_E(3);
     #endif
-    #if _MINMAX_TEST(3, MAX)
+    #if _USER_MINMAX_TEST(3, MAX)
       _TEMP_MAX_E(3);
     #endif
-    #if _MINMAX_TEST(4, MIN)
+    #if _USER_MINMAX_TEST(4, MIN)
       _TEMP_MIN_E(4);
     #endif
-    #if _MINMAX_TEST(4, MAX)
+    #if _USER_MINMAX_TEST(4, MAX)
       _TEMP_MAX_E(4);
     #endif
-    #if _MINMAX_TEST(5, MIN)
+    #if _USER_MINMAX_TEST(5, MIN)
       _TEMP_MIN_E(5);
     #endif
-    #if _MINMAX_TEST(5, MAX)
+    #if _USER_MINMAX_TEST(5, MAX)
       _TEMP_MAX_E(5);
     #endif
-    #if _MINMAX_TEST(6, MIN)
+    #if _USER_MINMAX_TEST(6, MIN)
       _TEMP_MIN_E(6);
     #endif
-    #if _MINMAX_TEST(6, MAX)
+    #if _USER_MINMAX_TEST(6, MAX)
       _TEMP_MAX_E(6);
     #endif
-    #if _MINMAX_TEST(7, MIN)
+    #if _USER_MINMAX_TEST(7, MIN)
       _TEMP_MIN_E(7);
     #endif
-    #if _MINMAX_TEST(7, MAX)
+    #if _USER_MINMAX_TEST(7, MAX)
       _TEMP_MAX_E(7);
     #endif
 
   #endif // HAS_HOTEND
 
   #if HAS_HEATED_BED
-    #ifdef BED_MINTEMP
+    #if defined(BED_MINTEMP) && !BED_TABLE_LIMITS
       while (analog_to_celsius_bed(mintemp_raw_BED) < BED_MINTEMP) mintemp_raw_BED += TEMPDIR(BED) * (OVERSAMPLENR);
     #endif
-    #ifdef BED_MAXTEMP
+    #if defined(BED_MAXTEMP) && !BED_TABLE_LIMITS
       while (analog_to_celsius_bed(maxtemp_raw_BED) > BED_MAXTEMP) maxtemp_raw_BED -= TEMPDIR(BED) * (OVERSAMPLENR);
     #endif
   #endif // HAS_HEATED_BED
 
   #if HAS_HEATED_CHAMBER
-    #ifdef CHAMBER_MINTEMP
+    #if defined(CHAMBER_MINTEMP) && !CHAMBER_TABLE_LIMITS
       while (analog_to_celsius_chamber(mintemp_raw_CHAMBER) < CHAMBER_MINTEMP) mintemp_raw_CHAMBER += TEMPDIR(CHAMBER) * (OVERSAMPLENR);
     #endif
-    #ifdef CHAMBER_MAXTEMP
+    #if defined(CHAMBER_MAXTEMP) && !CHAMBER_TABLE_LIMITS
       while (analog_to_celsius_chamber(maxtemp_raw_CHAMBER) > CHAMBER_MAXTEMP) maxtemp_raw_CHAMBER -= TEMPDIR(CHAMBER) * (OVERSAMPLENR);
     #endif
   #endif
@@ -24,7 +24,7 @@
 #define REVERSE_TEMP_SENSOR_RANGE_20 1
 
 // Pt100 with INA826 amp on Ultimaker v2.0 electronics
-const temp_entry_t temptable_20[] PROGMEM = {
+constexpr temp_entry_t temptable_20[] PROGMEM = {
   { OV(  0),    0 },
   { OV(227),    1 },
   { OV(236),   10 },
@@ -187,7 +187,7 @@ typedef struct { int16_t value, celsius; } temp_entry_t;
   #include "thermistor_999.h"
 #endif
 #if ANY_THERMISTOR_IS(1000) // Custom
-  const temp_entry_t temptable_1000[] PROGMEM = { { 0, 0 } };
+  constexpr temp_entry_t temptable_1000[] PROGMEM = { { 0, 0 } };
 #endif
 
 #define _TT_NAME(_N) temptable_ ## _N
@@ -312,6 +312,32 @@ static_assert(
   "Temperature conversion tables over 255 entries need special consideration."
 );
 
+/**
+ * Table lookups at compile time, so the raw value limits of each sensor
+ * are known without stepping through the ADC range at startup.
+ */
+
+// The temperature for a raw value, interpolated the same as SCAN_THERMISTOR_TABLE
+constexpr float thermistor_celsius(const temp_entry_t * const tt, const uint8_t len, const int16_t raw, const uint8_t i=1) {
+  return raw < tt[0].value ? tt[0].celsius
+       : i >= len ? tt[len - 1].celsius
+       : raw <= tt[i].value ? tt[i - 1].celsius + (raw - tt[i - 1].value) * float(tt[i].celsius - tt[i - 1].celsius) / float(tt[i].value - tt[i - 1].value)
+       : thermistor_celsius(tt, len, raw, i + 1);
+}
+
+// Stepping 'step' at a time from 'start', the first raw value where the temperature
+// reaches 'limit' going up (rising) or down. A binary search over the ADC range.
+constexpr int16_t thermistor_raw_limit(const temp_entry_t * const tt, const uint8_t len,
+  const int16_t start, const int16_t step, const float limit, const bool rising,
+  const uint16_t lo=0, const uint16_t hi=HAL_ADC_RANGE - 1
+) {
+  return lo >= hi ? int16_t(start + lo * step)
+       : (rising ? thermistor_celsius(tt, len, start + (lo + hi) / 2 * step) >= limit
+                 : thermistor_celsius(tt, len, start + (lo + hi) / 2 * step) <= limit)
+         ? thermistor_raw_limit(tt, len, start, step, limit, rising, lo, (lo + hi) / 2)
+         : thermistor_raw_limit(tt, len, start, step, limit, rising, (lo + hi) / 2 + 1, hi);
+}
+
 // Set the high and low raw values for the heaters
 // For thermistors the highest temperature results in the lowest ADC value
 // For thermocouples the highest temperature results in the highest ADC value
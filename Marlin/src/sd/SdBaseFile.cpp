@@ -1023,6 +1023,7 @@ int16_t SdBaseFile::read(void* buf, uint16_t nbyte) {
   // amount left to read
   toRead = nbyte;
   while (toRead > 0) {
+    uint8_t blocksLeft = 1;         // blocks left in this cluster
     offset = curPosition_ & 0x1FF;  // offset in block
     if (type_ == FAT_FILE_TYPE_ROOT_FIXED) {
       block = vol_->rootDirStart() + (curPosition_ >> 9);
@@ -1037,6 +1038,7 @@ int16_t SdBaseFile::read(void* buf, uint16_t nbyte) {
           return -1;
       }
       block = vol_->clusterStartBlock(curCluster_) + blockOfCluster;
+      blocksLeft = vol_->blocksPerCluster() - blockOfCluster;
     }
     uint16_t n = toRead;
 
@@ -1045,7 +1047,12 @@ int16_t SdBaseFile::read(void* buf, uint16_t nbyte) {
 
     // no buffering needed if n == 512
     if (n == 512 && block != vol_->cacheBlockNumber()) {
-      if (!vol_->readBlock(block, dst)) return -1;
+      // read whole blocks up to the end of the cluster or the cached block in one go
+      uint8_t count = _MIN(toRead >> 9, blocksLeft);
+      const uint32_t cached = vol_->cacheBlockNumber();
+      if (cached > block && cached < block + count) count = cached - block;
+      if (!vol_->readBlocks(block, count, dst)) return -1;
+      n = uint16_t(count) << 9;
     }
     else {
       // read block to cache and copy data to caller
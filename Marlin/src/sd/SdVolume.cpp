@@ -157,6 +157,25 @@ bool SdVolume::chainSize(uint32_t cluster, uint32_t* size) {
   return true;
 }
 
+/**
+ * Read consecutive blocks with a single multi-block command (CMD18)
+ * where the card driver has one. If that fails, fall back to reading
+ * one block at a time, which has retries with SD_CHECK_AND_RETRY.
+ */
+bool SdVolume::readBlocks(uint32_t block, uint8_t count, uint8_t* dst) {
+  #if DISABLED(SDIO_SUPPORT)
+    if (count > 1) {
+      bool success = sdCard_->readStart(block);
+      for (uint8_t i = 0; success && i < count; i++)
+        success = sdCard_->readData(dst + (uint16_t(i) << 9));
+      if (sdCard_->readStop() && success) return true;
+    }
+  #endif
+  for (; count; --count, ++block, dst += 512)
+    if (!readBlock(block, dst)) return false;
+  return true;
+}
+
 // Fetch a FAT entry
 bool SdVolume::fatGet(uint32_t cluster, uint32_t* value) {
   uint32_t lba;
@@ -51,6 +51,14 @@
   #include "../feature/pause.h"
 #endif
 
+#if ENABLED(CANCEL_OBJECTS_INDEX)
+  #include "../feature/object_index.h"
+#endif
+
+#if ENABLED(PRINT_TIME_ESTIMATE)
+  #include "../feature/time_estimate.h"
+#endif
+
 // public:
 
 card_flags_t CardReader::flag;
@@ -76,7 +84,9 @@ uint8_t CardReader::workDirDepth;
     //bool CardReader::sort_reverse;
   #endif
 
-  #if ENABLED(SDSORT_DYNAMIC_RAM)
+  #if ENABLED(SDCARD_DIR_INDEX)
+    uint16_t CardReader::sort_order[SDCARD_DIR_INDEX_LIMIT];
+  #elif ENABLED(SDSORT_DYNAMIC_RAM)
     uint8_t *CardReader::sort_order;
   #else
     uint8_t CardReader::sort_order[SDSORT_LIMIT];
@@ -109,6 +119,12 @@ uint8_t CardReader::workDirDepth;
 
 #endif // SDCARD_SORT_ALPHA
 
+#if ENABLED(SDCARD_DIR_INDEX)
+  dir_index_t CardReader::dir_index[SDCARD_DIR_INDEX_LIMIT];
+  uint16_t CardReader::dir_count, CardReader::dir_total;
+  uint32_t CardReader::dir_tail;
+#endif
+
 Sd2Card CardReader::sd2card;
 SdVolume CardReader::volume;
 SdFile CardReader::file;
@@ -119,6 +135,19 @@ char CardReader::proc_filenames[SD_PROCEDURE_DEPTH][MAXPATHNAMELENGTH];
 
 uint32_t CardReader::filesize, CardReader::sdpos;
 
+#if HAS_SD_READ_AHEAD
+  uint8_t CardReader::stream_buffer[SD_READ_AHEAD_BLOCKS * 512];
+  uint16_t CardReader::stream_pos, CardReader::stream_len;
+  uint32_t CardReader::stream_start;
+#endif
+
+#if ENABLED(SD_COMPRESSED_GCODE)
+  heatshrink_decoder CardReader::gcz_decoder;
+  uint8_t CardReader::gcz_buffer[64], CardReader::gcz_pos, CardReader::gcz_len;
+  uint32_t CardReader::gcz_index, CardReader::gcz_next;
+  bool CardReader::gcz_eof;
+#endif
+
 CardReader::CardReader() {
   #if ENABLED(SDCARD_SORT_ALPHA)
     sort_count = 0;
@@ -146,16 +175,17 @@ CardReader::CardReader() {
 //
 // Get a DOS 8.3 filename in its useful form
 //
-char *createFilename(char * const buffer, const dir_t &p) {
+static char *createFilename(char * const buffer, const uint8_t * const name) {
   char *pos = buffer;
   LOOP_L_N(i, 11) {
-    if (p.name[i] == ' ') continue;
+    if (name[i] == ' ') continue;
     if (i == 8) *pos++ = '.';
-    *pos++ = p.name[i];
+    *pos++ = name[i];
   }
   *pos++ = 0;
   return buffer;
 }
+char *createFilename(char * const buffer, const dir_t &p) { return createFilename(buffer, p.name); }
 
 int32_t createFileCreatedata(int32_t CreateData,const dir_t &p)
 {
@@ -221,9 +251,9 @@ int CardReader::countItems(SdFile dir) {
 //
 // Get file/folder info for an item by index
 //
-void CardReader::selectByIndex(SdFile dir, const uint8_t index) {
+void CardReader::selectByIndex(SdFile dir, const uint16_t index) {
   dir_t p;
-  for (uint8_t cnt = 0; dir.readDir(&p, longFilename) > 0;) {
+  for (uint16_t cnt = 0; dir.readDir(&p, longFilename) > 0;) {
     if (is_dir_or_gcode(p)) {
       if (cnt == index) {
         createFilename(filename, p);
@@ -457,6 +487,7 @@ void CardReader::release() {
   endFilePrint();
   flag.mounted = false;
   flag.workDirIsRoot = true;
+  TERN_(SDCARD_DIR_INDEX, flush_dir_index());
   #if ALL(SDCARD_SORT_ALPHA, SDSORT_USES_RAM, SDSORT_CACHE_NAMES)
     nrFiles = 0;
   #endif
@@ -560,11 +591,11 @@ void CardReader::openFileRead(char * const path, const uint8_t subcall_type/*=0*
 
       // Store current filename (based on workDirParents) and position
       getAbsFilename(proc_filenames[file_subcall_ctr]);
-      filespos[file_subcall_ctr] = sdpos;
+      filespos[file_subcall_ctr] = getIndex();
 
       // For sub-procedures say 'SUBROUTINE CALL target: "..." parent: "..." pos12345'
       SERIAL_ECHO_START();
-      SERIAL_ECHOLNPAIR("SUBROUTINE CALL target:\"", path, "\" parent:\"", proc_filenames[file_subcall_ctr], "\" pos", sdpos);
+      SERIAL_ECHOLNPAIR("SUBROUTINE CALL target:\"", path, "\" parent:\"", proc_filenames[file_subcall_ctr], "\" pos", filespos[file_subcall_ctr]);
       file_subcall_ctr++;
       break;
 
@@ -579,9 +610,12 @@ void CardReader::openFileRead(char * const path, const uint8_t subcall_type/*=0*
   const char * const fname = diveToFile(true, curDir, path);
   if (!fname) return;
 
-  if (file.open(curDir, fname, O_READ)) {
+  if (TERN0(SDCARD_DIR_INDEX, (curDir == &workDir && open_dir_index(fname))) || file.open(curDir, fname, O_READ)) {
     filesize = file.fileSize();
     sdpos = 0;
+    TERN_(HAS_SD_READ_AHEAD, stream_clear());
+    TERN_(SD_COMPRESSED_GCODE, gcz_open(fname));
+    TERN_(CANCEL_OBJECTS_INDEX, object_index.reset());
 
     PORT_REDIRECT(SERIAL_BOTH);
     SERIAL_ECHOLNPAIR(STR_SD_FILE_OPENED, fname, STR_SD_SIZE, filesize);
@@ -619,6 +653,7 @@ void CardReader::openFileWrite(char * const path) {
   #else
     if (file.open(curDir, fname, O_CREAT | O_APPEND | O_WRITE | O_TRUNC)) {
       flag.saving = true;
+      TERN_(SDCARD_DIR_INDEX, flush_dir_index());
       selectFileByName(fname);
       TERN_(EMERGENCY_PARSER, emergency_parser.disable());
       echo_write_to_file(fname);
@@ -647,6 +682,7 @@ void CardReader::removeFile(const char * const name) {
     if (file.remove(curDir, fname)) {
       SERIAL_ECHOLNPAIR("File deleted:", fname);
       sdpos = 0;
+      TERN_(SDCARD_DIR_INDEX, flush_dir_index());
       TERN_(SDCARD_SORT_ALPHA, presort());
     }
     else
@@ -660,6 +696,7 @@ void CardReader::report_status() {
     SERIAL_ECHO(sdpos);
     SERIAL_CHAR('/');
     SERIAL_ECHOLN(filesize);
+    TERN_(PRINT_TIME_ESTIMATE, time_estimate.report());
   }
   else
     SERIAL_ECHOLNPGM(STR_SD_NOT_PRINTING);
@@ -723,8 +760,10 @@ void CardReader::beginautostart() {
 void CardReader::closefile(const bool store_location) {
   file.sync();
   file.close();
+  TERN_(SDCARD_DIR_INDEX, if (flag.saving) flush_dir_index()); // Its size changed
   flag.saving = flag.logging = false;
   sdpos = 0;
+  TERN_(HAS_SD_READ_AHEAD, stream_clear());
   TERN_(EMERGENCY_PARSER, emergency_parser.enable());
 
   if (store_location) {
@@ -745,6 +784,18 @@ void CardReader::selectFileByIndex(const uint16_t nr) {
       return;
     }
   #endif
+  #if ENABLED(SDCARD_DIR_INDEX)
+    if (!flag.workDirIndexed) index_dir();
+    if (nr < dir_count) {
+      if (read_dir_index(nr)) return;
+      flush_dir_index();                // Stale. Scan this time and re-index next time.
+    }
+    else if (dir_tail) {                // Past the end of a full index
+      workDir.seekSet(dir_tail);
+      selectByIndex(workDir, nr - dir_count);
+      return;
+    }
+  #endif
   workDir.rewind();
   selectByIndex(workDir, nr);
 }
@@ -762,15 +813,156 @@ void CardReader::selectFileByName(const char * const match) {
         return;
       }
   #endif
+  #if ENABLED(SDCARD_DIR_INDEX)
+    const int16_t i = find_dir_index(match);
+    if (i >= 0 && read_dir_index(i)) return;
+  #endif
   workDir.rewind();
   selectByName(workDir, match);
 }
 
 uint16_t CardReader::countFilesInWorkDir() {
-  workDir.rewind();
-  return countItems(workDir);
+  #if ENABLED(SDCARD_DIR_INDEX)
+    if (!flag.workDirIndexed) index_dir();
+    return dir_total;
+  #else
+    workDir.rewind();
+    return countItems(workDir);
+  #endif
 }
 
+#if ENABLED(SDCARD_DIR_INDEX)
+
+  /**
+   * Index the listed items of the working directory in one scan, noting
+   * where each one's entries begin so it can be read back directly.
+   * Items past SDCARD_DIR_INDEX_LIMIT are only counted.
+   */
+  void CardReader::index_dir() {
+    flag.workDirIndexed = true;
+    dir_count = dir_total = 0;
+    dir_tail = 0;
+
+    dir_t p;
+    workDir.rewind();
+    for (;;) {
+      const uint32_t start = workDir.curPosition();
+      if (workDir.readDir(&p, longFilename) <= 0) break;
+      if (!is_dir_or_gcode(p)) continue;
+      dir_total++;
+      if (dir_count >= SDCARD_DIR_INDEX_LIMIT) continue;
+
+      dir_index_t &d = dir_index[dir_count++];
+      d.start = start >> 5;
+      d.entry = (workDir.curPosition() >> 5) - 1;
+      d.size = p.fileSize;
+      d.cluster = (uint32_t)p.firstClusterHigh << 16 | p.firstClusterLow;
+      memcpy(d.name, p.name, sizeof(d.name));
+      d.isDir = DIR_IS_SUBDIR(&p);
+      createFilename(filename, p);
+      strncpy(d.key, longest_filename(), SDCARD_DIR_INDEX_KEY);
+      if (dir_count == SDCARD_DIR_INDEX_LIMIT) dir_tail = workDir.curPosition();
+    }
+
+    TERN_(SDCARD_SORT_ALPHA, sort_dir_index());
+  }
+
+  /**
+   * Read an indexed item back from its entries and select it.
+   * Return false if the entry no longer matches the index.
+   */
+  bool CardReader::read_dir_index(const uint16_t i) {
+    const dir_index_t &d = dir_index[i];
+    dir_t p;
+    if (!workDir.seekSet(uint32_t(d.start) << 5)
+      || workDir.readDir(&p, longFilename) <= 0
+      || memcmp(p.name, d.name, sizeof(d.name))
+    ) return false;
+    createFilename(filename, p);
+    flag.filenameIsDir = d.isDir;
+    return true;
+  }
+
+  //
+  // Get the index of an item by DOS name, or -1 if it's not indexed
+  //
+  int16_t CardReader::find_dir_index(const char * const match) {
+    if (flag.workDirIndexed) {
+      char dosFilename[FILENAME_LENGTH];
+      LOOP_L_N(i, dir_count)
+        if (strcasecmp(match, createFilename(dosFilename, dir_index[i].name)) == 0) return i;
+    }
+    return -1;
+  }
+
+  //
+  // Open an indexed file by its entry, checked against the cached size and first cluster
+  //
+  bool CardReader::open_dir_index(const char * const match) {
+    const int16_t i = find_dir_index(match);
+    if (i < 0) return false;
+    const dir_index_t &d = dir_index[i];
+    if (file.open(&workDir, d.entry, O_READ)) {
+      if (file.firstCluster() == d.cluster && file.fileSize() == d.size) return true;
+      file.close();
+    }
+    flush_dir_index();
+    return false;
+  }
+
+  #if ENABLED(SDCARD_SORT_ALPHA)
+
+    //
+    // Compare two indexed items. Read the full names only when the keys can't tell them apart.
+    //
+    bool CardReader::sorts_after(const uint16_t a, const uint16_t b) {
+      const dir_index_t &da = dir_index[a], &db = dir_index[b];
+      #if HAS_FOLDER_SORTING
+        const int fs = TERN(SDSORT_GCODE, sort_folders, FOLDER_SORTING);
+        if (fs && da.isDir != db.isDir) return fs > 0 ? da.isDir : db.isDir;
+      #endif
+      const int c = strncasecmp(da.key, db.key, SDCARD_DIR_INDEX_KEY);
+      if (c || !da.key[SDCARD_DIR_INDEX_KEY - 1]) return c > 0;
+      char name1[LONG_FILENAME_LENGTH];
+      if (!read_dir_index(a)) return false;
+      strcpy(name1, longest_filename());
+      return read_dir_index(b) && strcasecmp(name1, longest_filename()) > 0;
+    }
+
+    //
+    // Heapsort the index into sort_order
+    //
+    void CardReader::sort_dir_index() {
+      const uint16_t n = dir_count;
+      LOOP_L_N(i, n) sort_order[i] = i;
+      sort_count = n;
+      if (TERN0(SDSORT_GCODE, !sort_alpha)) return;
+
+      // Move an item down the heap below 'end' until its children don't sort after it
+      auto sift = [](uint16_t root, const uint16_t end) {
+        const uint16_t item = sort_order[root];
+        for (uint16_t child; (child = 2 * root + 1) < end; root = child) {
+          if (child + 1 < end && sorts_after(sort_order[child + 1], sort_order[child])) child++;
+          if (!sorts_after(sort_order[child], item)) break;
+          sort_order[root] = sort_order[child];
+        }
+        sort_order[root] = item;
+      };
+
+      for (uint16_t i = n / 2; i--;) sift(i, n);
+      for (uint16_t end = n; end > 1;) {
+        --end;
+        const uint16_t top = sort_order[0];
+        sort_order[0] = sort_order[end];
+        sort_order[end] = top;
+        sift(0, end);
+      }
+    }
+
+  #endif // SDCARD_SORT_ALPHA
+
+#endif // SDCARD_DIR_INDEX
+
 /**
  * Dive to the given DOS 8.3 file path, with optional echo of the dive paths.
  *
@@ -828,6 +1020,7 @@ const char* CardReader::diveToFile(const bool update_cwd, SdFile*& curDir, const
     if (update_cwd) {
       if (workDirDepth < MAX_DIR_DEPTH) workDirParents[workDirDepth++] = *curDir;
       workDir = *curDir;
+      TERN_(SDCARD_DIR_INDEX, flush_dir_index());
     }
 
     // Point sub at the other scratch object
@@ -848,6 +1041,7 @@ void CardReader::cd(const char * relpath) {
     flag.workDirIsRoot = false;
     if (workDirDepth < MAX_DIR_DEPTH)
       workDirParents[workDirDepth++] = workDir;
+    TERN_(SDCARD_DIR_INDEX, flush_dir_index());
     TERN_(SDCARD_SORT_ALPHA, presort());
   }
   else {
@@ -859,6 +1053,7 @@ void CardReader::cd(const char * relpath) {
 int8_t CardReader::cdup() {
   if (workDirDepth > 0) {                                               // At least 1 dir has been saved
     workDir = --workDirDepth ? workDirParents[workDirDepth - 1] : root; // Use parent, or root if none
+    TERN_(SDCARD_DIR_INDEX, flush_dir_index());
     //TERN_(SDCARD_SORT_ALPHA, presort());
   }
   if (!workDirDepth) flag.workDirIsRoot = true;
@@ -868,6 +1063,7 @@ int8_t CardReader::cdup() {
 void CardReader::cdroot() {
   workDir = root;
   flag.workDirIsRoot = true;
+  TERN_(SDCARD_DIR_INDEX, flush_dir_index());
   //TERN_(SDCARD_SORT_ALPHA, presort());
 }
 
@@ -877,9 +1073,20 @@ void CardReader::cdroot() {
    * Get the name of a file in the working directory by sort-index
    */
   void CardReader::getfilename_sorted(const uint16_t nr) {
+    TERN_(SDCARD_DIR_INDEX, if (!flag.workDirIndexed) index_dir());
     selectFileByIndex(TERN1(SDSORT_GCODE, sort_alpha) && (nr < sort_count)
       ? sort_order[nr] : nr);
   }
+
+  #if ENABLED(SDCARD_DIR_INDEX)
+
+    /**
+     * Index the working directory if it changed. The index is sorted as it's made.
+     */
+    void CardReader::presort() { if (!flag.workDirIndexed) index_dir(); }
+
+  #else // !SDCARD_DIR_INDEX
+
   #if ENABLED(SDSORT_USES_RAM)
     #if ENABLED(SDSORT_DYNAMIC_RAM)
       // Use dynamic method to copy long filename
@@ -1097,6 +1304,8 @@ void CardReader::cdroot() {
     }
   }
 
+  #endif // !SDCARD_DIR_INDEX
+
   void CardReader::flush_presort() {
     if (sort_count > 0) {
       #if ENABLED(SDSORT_DYNAMIC_RAM)
@@ -1127,12 +1336,97 @@ uint16_t CardReader::get_num_Files() {
   );
 }
 
+#if HAS_SD_READ_AHEAD
+
+  /**
+   * Refill the read-ahead buffer. After a seek the first read stops at a
+   * block boundary, so every read after it is made of whole blocks that
+   * SdBaseFile fetches with a multi-block command instead of the cache.
+   */
+  bool CardReader::stream_fill() {
+    stream_start = file.curPosition();
+    const int16_t n = file.read(stream_buffer, sizeof(stream_buffer) - (stream_start & 0x1FF));
+    stream_pos = 0;
+    stream_len = _MAX(n, 0);
+    if (!stream_len) sdpos = stream_start;
+    return stream_len;
+  }
+
+#endif
+
+#if ENABLED(SD_COMPRESSED_GCODE)
+
+  // Files named *.gcz are heatshrink-compressed
+  void CardReader::gcz_open(const char * const fname) {
+    const char * const ext = strrchr(fname, '.');
+    flag.compressed = ext && toupper(ext[1]) == 'G' && toupper(ext[2]) == 'C' && toupper(ext[3]) == 'Z' && !ext[4];
+    if (flag.compressed) gcz_seek(0);
+  }
+
+  /**
+   * The decoded position of a byte can't be mapped to the file, so
+   * decode from the top of the file and drop bytes up to the index.
+   */
+  void CardReader::gcz_seek(const uint32_t index) {
+    TERN_(HAS_SD_READ_AHEAD, stream_clear());
+    sdpos = 0;
+    file.seekSet(0);
+    heatshrink_decoder_reset(&gcz_decoder);
+    gcz_pos = gcz_len = 0;
+    gcz_next = 0;
+    gcz_eof = false;
+    while (gcz_next < index) {
+      if (gcz_pos >= gcz_len && !gcz_fill()) { gcz_eof = true; break; }
+      const uint8_t n = _MIN(index - gcz_next, uint32_t(gcz_len - gcz_pos));
+      gcz_pos += n;
+      gcz_next += n;
+    }
+    gcz_index = gcz_next;
+  }
+
+  // Give the decoder the next compressed bytes. False at the end of the file.
+  bool CardReader::gcz_sink() {
+    size_t count;
+    #if HAS_SD_READ_AHEAD
+      if (stream_pos >= stream_len && !stream_fill()) return false;
+      heatshrink_decoder_sink(&gcz_decoder, &stream_buffer[stream_pos], stream_len - stream_pos, &count);
+      stream_pos += count;
+      sdpos = stream_start + stream_pos;
+    #else
+      // The decoder has used up its input, so it takes all of this
+      uint8_t in[HEATSHRINK_STATIC_INPUT_BUFFER_SIZE];
+      const int16_t n = file.read(in, sizeof(in));
+      if (n <= 0) return false;
+      heatshrink_decoder_sink(&gcz_decoder, in, n, &count);
+      sdpos = file.curPosition();
+    #endif
+    return true;
+  }
+
+  /**
+   * Refill the decoded buffer. The decoder only stops short of a full
+   * buffer when its input runs out, so sink more and poll again.
+   */
+  bool CardReader::gcz_fill() {
+    gcz_pos = 0;
+    for (;;) {
+      size_t count;
+      heatshrink_decoder_poll(&gcz_decoder, gcz_buffer, sizeof(gcz_buffer), &count);
+      gcz_len = count;
+      if (count) return true;
+      if (!gcz_sink()) return false;
+    }
+  }
+
+#endif
+
 //
 // Return from procedure or close out the Print Job
 //
 void CardReader::fileHasFinished() {
   planner.synchronize();
   file.close();
+  TERN_(HAS_SD_READ_AHEAD, stream_clear());
   if (file_subcall_ctr > 0) { // Resume calling file after closing procedure
     file_subcall_ctr--;
     openFileRead(proc_filenames[file_subcall_ctr], 2); // 2 = Returning from sub-procedure
@@ -1174,7 +1468,7 @@ void CardReader::fileHasFinished() {
   void CardReader::openJobRecoveryFile(const bool read) {
     if (!isMounted()) return;
     if (recovery.file.isOpen()) return;
-    if (!recovery.file.open(&root, recovery.filename, read ? O_READ : O_CREAT | O_WRITE | O_TRUNC | O_SYNC))
+    if (!recovery.file.open(&root, recovery.filename, read ? O_READ : O_CREAT | O_WRITE | TERN(POWER_LOSS_JOURNAL, 0, O_TRUNC | O_SYNC)))
       SERIAL_ECHOLNPAIR(STR_SD_OPEN_FILE_FAIL, recovery.filename, ".");
     else if (!read)
       echo_write_to_file(recovery.filename);
@@ -43,6 +43,10 @@
 
 #include "SdFile.h"
 
+#if ENABLED(SD_COMPRESSED_GCODE)
+  #include "../libs/heatshrink/heatshrink_decoder.h"
+#endif
+
 typedef struct {
   bool saving:1,
        logging:1,
@@ -54,9 +58,27 @@ typedef struct {
        #if ENABLED(BINARY_FILE_TRANSFER)
          , binary_mode:1
        #endif
+       #if ENABLED(SD_COMPRESSED_GCODE)
+         , compressed:1
+       #endif
+       #if ENABLED(SDCARD_DIR_INDEX)
+         , workDirIndexed:1
+       #endif
     ;
 } card_flags_t;
 
+#if ENABLED(SDCARD_DIR_INDEX)
+  // A listed item of the working directory, as found by CardReader::index_dir()
+  typedef struct {
+    uint16_t start,                     // Directory entry where the item's long name begins
+             entry;                     // Directory entry of the 8.3 name
+    uint32_t size, cluster;             // File size and first cluster, to check the entry on open
+    uint8_t name[11];                   // 8.3 name as it is in the entry
+    bool isDir;
+    char key[SDCARD_DIR_INDEX_KEY];     // Start of the long name for sorting. No nul when it's full.
+  } dir_index_t;
+#endif
+
 class CardReader {
 public:
   static card_flags_t flag;                         // Flags (above)
@@ -79,6 +101,7 @@ public:
   CardReader();
 
   static SdFile getroot() { return root; }
+  static SdFile getfile() { return file; }
 
   static void mount();
   static void release();
@@ -141,8 +164,8 @@ public:
     static void presort();
     static void getfilename_sorted(const uint16_t nr);
     #if ENABLED(SDSORT_GCODE)
-      FORCE_INLINE static void setSortOn(bool b) { sort_alpha = b; presort(); }
-      FORCE_INLINE static void setSortFolders(int i) { sort_folders = i; presort(); }
+      FORCE_INLINE static void setSortOn(bool b) { sort_alpha = b; TERN_(SDCARD_DIR_INDEX, flush_dir_index()); presort(); }
+      FORCE_INLINE static void setSortFolders(int i) { sort_folders = i; TERN_(SDCARD_DIR_INDEX, flush_dir_index()); presort(); }
       //FORCE_INLINE static void setSortReverse(bool b) { sort_reverse = b; }
     #endif
   #else
@@ -156,14 +179,36 @@ public:
   #endif
 
   static inline bool isFileOpen() { return isMounted() && file.isOpen(); }
-  static inline uint32_t getIndex() { return sdpos; }
+  static inline uint32_t getIndex() { TERN_(SD_COMPRESSED_GCODE, if (flag.compressed) return gcz_index); return sdpos; }
   static inline uint32_t getFileSize() { return filesize; }
-  static inline bool eof() { return sdpos >= filesize; }
-  static inline void setIndex(const uint32_t index) { sdpos = index; file.seekSet(index); }
+  static inline bool eof() { TERN_(SD_COMPRESSED_GCODE, if (flag.compressed) return gcz_eof); return sdpos >= filesize; }
   static inline char* getWorkDirName() { workDir.getDosName(filename); return filename; }
-  static inline int16_t get() { sdpos = file.curPosition(); return (int16_t)file.read(); }
-  static inline int16_t read(void* buf, uint16_t nbyte) { return file.isOpen() ? file.read(buf, nbyte) : -1; }
-  static inline int16_t write(void* buf, uint16_t nbyte) { return file.isOpen() ? file.write(buf, nbyte) : -1; }
+
+  #if HAS_SD_READ_AHEAD
+    static inline void setIndex(const uint32_t index) {
+      TERN_(SD_COMPRESSED_GCODE, if (flag.compressed) return gcz_seek(index));
+      stream_clear(); sdpos = index; file.seekSet(index);
+    }
+    static inline int16_t get() {
+      TERN_(SD_COMPRESSED_GCODE, if (flag.compressed) return gcz_get());
+      if (stream_pos >= stream_len && !stream_fill()) return -1;
+      sdpos = stream_start + stream_pos;
+      return stream_buffer[stream_pos++];
+    }
+    static inline int16_t read(void* buf, uint16_t nbyte) { stream_sync(); return file.isOpen() ? file.read(buf, nbyte) : -1; }
+    static inline int16_t write(void* buf, uint16_t nbyte) { stream_sync(); return file.isOpen() ? file.write(buf, nbyte) : -1; }
+  #else
+    static inline void setIndex(const uint32_t index) {
+      TERN_(SD_COMPRESSED_GCODE, if (flag.compressed) return gcz_seek(index));
+      sdpos = index; file.seekSet(index);
+    }
+    static inline int16_t get() {
+      TERN_(SD_COMPRESSED_GCODE, if (flag.compressed) return gcz_get());
+      sdpos = file.curPosition(); return (int16_t)file.read();
+    }
+    static inline int16_t read(void* buf, uint16_t nbyte) { return file.isOpen() ? file.read(buf, nbyte) : -1; }
+    static inline int16_t write(void* buf, uint16_t nbyte) { return file.isOpen() ? file.write(buf, nbyte) : -1; }
+  #endif
 
   static Sd2Card& getSd2Card() { return sd2card; }
 
@@ -196,7 +241,9 @@ private:
     #endif
 
     // By default the sort index is static
-    #if ENABLED(SDSORT_DYNAMIC_RAM)
+    #if ENABLED(SDCARD_DIR_INDEX)
+      static uint16_t sort_order[SDCARD_DIR_INDEX_LIMIT];
+    #elif ENABLED(SDSORT_DYNAMIC_RAM)
       static uint8_t *sort_order;
     #else
       static uint8_t sort_order[SDSORT_LIMIT];
@@ -240,12 +287,59 @@ private:
 
   #endif // SDCARD_SORT_ALPHA
 
+  //
+  // Index of the working directory
+  //
+  #if ENABLED(SDCARD_DIR_INDEX)
+    static dir_index_t dir_index[SDCARD_DIR_INDEX_LIMIT];
+    static uint16_t dir_count,    // Items in the index
+                    dir_total;    // Items in the working directory
+    static uint32_t dir_tail;     // Position after the last indexed item, when the index is full
+  #endif
+
   static Sd2Card sd2card;
   static SdVolume volume;
   static SdFile file;
 
   static uint32_t filesize, sdpos;
 
+  #if HAS_SD_READ_AHEAD
+    //
+    // Read-ahead for printing. The file position is past the buffered data.
+    //
+    static uint8_t stream_buffer[SD_READ_AHEAD_BLOCKS * 512];
+    static uint16_t stream_pos, stream_len;   // Next byte and bytes in the buffer
+    static uint32_t stream_start;             // File position of stream_buffer[0]
+    static bool stream_fill();
+    static inline void stream_clear() { stream_pos = stream_len = 0; }
+    // Put the file position back where the reader is, for direct reads and writes
+    static inline void stream_sync() {
+      if (stream_pos < stream_len) file.seekSet(stream_start + stream_pos);
+      stream_clear();
+    }
+  #endif
+
+  #if ENABLED(SD_COMPRESSED_GCODE)
+    //
+    // Decoding of .gcz files. Here sdpos is the compressed position, for
+    // progress. getIndex() and setIndex() use the decoded position.
+    //
+    static heatshrink_decoder gcz_decoder;
+    static uint8_t gcz_buffer[64];            // Decoded bytes
+    static uint8_t gcz_pos, gcz_len;          // Next byte and bytes in the buffer
+    static uint32_t gcz_index, gcz_next;      // Decoded position of the last byte read and the next
+    static bool gcz_eof;
+    static void gcz_open(const char * const fname);
+    static void gcz_seek(const uint32_t index);
+    static bool gcz_sink();
+    static bool gcz_fill();
+    static inline int16_t gcz_get() {
+      if (gcz_pos >= gcz_len && !gcz_fill()) { gcz_eof = true; return -1; }
+      gcz_index = gcz_next++;
+      return gcz_buffer[gcz_pos++];
+    }
+  #endif
+
   //
   // Procedure calls to other files
   //
@@ -272,13 +366,25 @@ private:
   //
   static bool is_dir_or_gcode(const dir_t &p);
   static int countItems(SdFile dir);
-  static void selectByIndex(SdFile dir, const uint8_t index);
+  static void selectByIndex(SdFile dir, const uint16_t index);
   static void selectByName(SdFile dir, const char * const match);
   static void printListing(SdFile parent, const char * const prepend=nullptr);
 
   #if ENABLED(SDCARD_SORT_ALPHA)
     static void flush_presort();
   #endif
+
+  #if ENABLED(SDCARD_DIR_INDEX)
+    static void index_dir();
+    static inline void flush_dir_index() { flag.workDirIndexed = false; }
+    static bool read_dir_index(const uint16_t i);
+    static int16_t find_dir_index(const char * const match);
+    static bool open_dir_index(const char * const match);
+    #if ENABLED(SDCARD_SORT_ALPHA)
+      static bool sorts_after(const uint16_t a, const uint16_t b);
+      static void sort_dir_index();
+    #endif
+  #endif
 };
 
 #if ENABLED(USB_FLASH_DRIVE_SUPPORT)
@@ -0,0 +1,108 @@
+#!/usr/bin/env python
+
+""" Convert G-code to pre-tokenized binary commands for BINARY_GCODE.
+
+Each G, M or T command becomes a binary command with the code, a mask of the
+parameters and their values, as described in Marlin/src/gcode/binary_gcode.h.
+Values go as fixed-point thousandths when that is exact, or else as floats.
+Commands that take a string, or that don't fit, stay as ASCII lines.
+
+The output can be printed from SD, or each command can be sent in a binary
+transfer packet (Protocol GCODE, type COMMANDS) with encode() from this file.
+"""
+
+from __future__ import print_function
+from __future__ import division
+
+import argparse, re, struct, sys
+
+MARK, SUBCODE, CODE16, FIXED, NOVALUE = 0x80, 0x10, 0x08, 0x04, 0x02
+FIXED_SCALE = 1000
+LETTERS = {'G': 0, 'M': 1, 'T': 2}
+
+# Commands with a string argument, which the parser only gets from ASCII
+STRING_ARG = {('M', c) for c in (0, 1, 16, 23, 28, 29, 30, 32, 33, 117, 118, 119, 928)} | {('M', c) for c in range(810, 820)}
+
+COMMAND_RE = re.compile(r'([GMT])\s*(\d+)(?:\.(\d+))?')
+PARAM_RE = re.compile(r'([A-Z])\s*([-+]?(?:\d+\.?\d*|\.\d+))?')
+
+def strip(line):
+  """ Drop comments, a line number and a checksum """
+  line = re.sub(r'\([^)]*\)', '', line.split(';', 1)[0])
+  line = line.split('*', 1)[0].strip()
+  return re.sub(r'^N\d+\s*', '', line)
+
+def fixed_value(text):
+  """ The value in thousandths, if that's exact """
+  neg = text.startswith('-')
+  whole, _, frac = text.lstrip('+-').partition('.')
+  frac = frac.rstrip('0')
+  if len(frac) > 3: return None
+  v = int(whole or '0') * FIXED_SCALE + int((frac + '000')[:3])
+  if v >= 2**31: return None
+  return -v if neg else v
+
+def encode(line, max_size=96):
+  """ A binary command for one line of G-code, or None if it has to stay ASCII """
+  m = COMMAND_RE.match(line)
+  if not m: return None
+  letter, code, sub = m.group(1), int(m.group(2)), m.group(3)
+  if (letter, code) in STRING_ARG or code > 0xFFFF or (sub and int(sub) > 0xFF): return None
+
+  rest, values, novalue = line[m.end():], {}, 0
+  pos = 0
+  while pos < len(rest):
+    if rest[pos] == ' ': pos += 1; continue
+    p = PARAM_RE.match(rest, pos)
+    if not p or p.group(1) in values or novalue & (1 << (ord(p.group(1)) - 65)): return None
+    if p.group(2) is None:
+      novalue |= 1 << (ord(p.group(1)) - 65)
+    else:
+      values[p.group(1)] = p.group(2)
+    pos = p.end()
+
+  mask = 0
+  for k in values: mask |= 1 << (ord(k) - 65)
+  order = sorted(values)
+  fixed = [fixed_value(values[k]) for k in order]
+  use_fixed = all(v is not None for v in fixed)
+
+  kind = MARK | (LETTERS[letter] << 5)
+  if code > 0xFF: kind |= CODE16
+  if sub: kind |= SUBCODE
+  if use_fixed: kind |= FIXED
+  if novalue: kind |= NOVALUE
+
+  out = bytearray([kind])
+  out += struct.pack('<H' if code > 0xFF else '<B', code)
+  if sub: out.append(int(sub))
+  out += struct.pack('<I', mask)
+  if novalue: out += struct.pack('<I', novalue)
+  for k, f in zip(order, fixed):
+    out += struct.pack('<i', f) if use_fixed else struct.pack('<f', float(values[k]))
+  return bytes(out) if len(out) <= max_size else None
+
+if __name__ == '__main__':
+  parser = argparse.ArgumentParser(description=__doc__, formatter_class=argparse.RawDescriptionHelpFormatter)
+  parser.add_argument('input', help='G-code file')
+  parser.add_argument('output', help='binary G-code file, e.g., PRINT.GCB')
+  parser.add_argument('--max-size', type=int, default=96, help='MAX_CMD_SIZE of the firmware (default=96)')
+  args = parser.parse_args()
+
+  out, ascii_lines, binary = bytearray(), 0, 0
+  with open(args.input) as f:
+    for line in f:
+      line = strip(line)
+      if not line: continue
+      cmd = encode(line, args.max_size)
+      if cmd:
+        out += cmd
+        binary += 1
+      else:
+        out += line.encode() + b'\n'
+        ascii_lines += 1
+
+  with open(args.output, 'wb') as f:
+    f.write(out)
+
+  print('%d binary commands, %d ASCII lines, %d bytes' % (binary, ascii_lines, len(out)))
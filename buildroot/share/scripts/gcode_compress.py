@@ -0,0 +1,94 @@
+#!/usr/bin/env python
+
+""" Compress G-code for printing from SD with SD_COMPRESSED_GCODE.
+
+Writes a heatshrink stream with a 256 byte window and 16 byte lookahead,
+the static configuration of the decoder built into Marlin. Copy the output
+to the card with a .gcz extension. Comments and blank lines can be dropped
+first to save more space.
+"""
+
+from __future__ import print_function
+from __future__ import division
+
+import argparse, os, sys
+
+WINDOW_BITS = 8
+LOOKAHEAD_BITS = 4
+
+parser = argparse.ArgumentParser(description=__doc__, formatter_class=argparse.RawDescriptionHelpFormatter)
+parser.add_argument('input', help='G-code file')
+parser.add_argument('output', nargs='?', help='compressed file (default: input with .gcz extension)')
+parser.add_argument('-s', '--strip', action='store_true', help='drop comments and blank lines')
+args = parser.parse_args()
+
+class BitWriter:
+  def __init__(self):
+    self.out = bytearray()
+    self.byte = 0
+    self.bits = 0
+
+  def put(self, value, count):
+    for i in reversed(range(count)):
+      self.byte = (self.byte << 1) | ((value >> i) & 1)
+      self.bits += 1
+      if self.bits == 8:
+        self.out.append(self.byte)
+        self.byte = self.bits = 0
+
+  def flush(self):
+    # Zero padding reads as an incomplete backref, which the decoder ignores
+    if self.bits: self.put(0, 8 - self.bits)
+    return bytes(self.out)
+
+def compress(data):
+  window, lookahead = 1 << WINDOW_BITS, 1 << LOOKAHEAD_BITS
+  bw = BitWriter()
+  # Positions of each 2-byte prefix, to find match candidates quickly
+  heads = {}
+  i = 0
+  while i < len(data):
+    best_len, best_dist = 0, 0
+    key = data[i:i + 2]
+    if len(key) == 2:
+      limit = min(lookahead, len(data) - i)
+      for j in reversed(heads.get(key, [])):
+        dist = i - j
+        if dist > window: break
+        n = 2
+        while n < limit and data[j + n] == data[i + n]: n += 1
+        if n > best_len:
+          best_len, best_dist = n, dist
+          if n == limit: break
+    # A backref costs 13 bits, a literal 9, so matches of 2 or more pay off
+    step = best_len if best_len >= 2 else 1
+    if step > 1:
+      bw.put(0, 1)
+      bw.put(best_dist - 1, WINDOW_BITS)
+      bw.put(best_len - 1, LOOKAHEAD_BITS)
+    else:
+      bw.put(1, 1)
+      bw.put(data[i], 8)
+    for k in range(i, i + step):
+      pos = heads.setdefault(data[k:k + 2], [])
+      pos.append(k)
+      if len(pos) > 64: del pos[:32]
+    i += step
+  return bw.flush()
+
+with open(args.input, 'rb') as f:
+  data = f.read()
+
+if args.strip:
+  lines = []
+  for line in data.splitlines():
+    line = line.split(b';', 1)[0].strip()
+    if line: lines.append(line)
+  data = b'\n'.join(lines) + b'\n'
+
+output = args.output or os.path.splitext(args.input)[0] + '.gcz'
+packed = compress(data)
+with open(output, 'wb') as f:
+  f.write(packed)
+
+print('%s: %d bytes, %s: %d bytes (%.1f%%)' % (args.input, len(data), output, len(packed), 100.0 * len(packed) / max(len(data), 1)))
@@ -0,0 +1,179 @@
+#!/usr/bin/env python
+
+""" Check the step timing in a gpio_trace.bin from the linux_native simulator.
+
+Build the simulator with GPIO_TRACE (in HAL/LINUX/main.cpp, or add
+-DGPIO_TRACE to the build flags) and every pin change of the run is written
+to gpio_trace.bin in 8-byte records, so a whole print can be traced.
+
+For each axis this works out, from the STEP, DIR and ENABLE pins,
+
+  position     Net steps, as mm, and the range covered
+  velocity     Peak speed over a window of steps
+  acceleration Peak change of that speed
+  jitter       How far each step interval is from the mean of its neighbors,
+               which is 0 on a smooth ramp or cruise. (An axis that isn't
+               leading the move steps unevenly anyway.)
+  pulses       The shortest STEP high and low times, and the shortest time
+               from a DIR change to the next STEP (driver setup time)
+
+The window, and a gap long enough to count as a stop, can be set. Give --csv
+to write the position, velocity and acceleration at every step for plotting.
+"""
+
+from __future__ import print_function
+from __future__ import division
+
+import argparse, math, struct, sys
+
+parser = argparse.ArgumentParser(description=__doc__, formatter_class=argparse.RawDescriptionHelpFormatter)
+parser.add_argument('trace', nargs='?', default='gpio_trace.bin', help='trace file (default=gpio_trace.bin)')
+parser.add_argument('-w', '--window', type=int, default=16, help='steps to measure speed over (default=16)')
+parser.add_argument('-g', '--gap', type=float, default=50, help='a longer step interval is a stop (default=50ms)')
+parser.add_argument('-s', '--steps', action='append', default=[], metavar='AXIS=STEPS',
+                    help='steps per mm, if not as built (e.g. -s E=415)')
+parser.add_argument('--csv', help='write every step to this file')
+args = parser.parse_args()
+args.window = max(1, args.window)
+gap_ns = int(args.gap * 1e6)
+
+# GpioEvent::Type, and the record that only carries time
+NOP, FALL, RISE, SET_VALUE, SETM, SETD = range(6)
+TIME = 0xFF
+
+class Axis(object):
+  def __init__(self, name, flags, step_pin, dir_pin, enable_pin, steps_per_mm):
+    self.name, self.steps_per_mm = name, steps_per_mm
+    self.step_pin, self.dir_pin, self.enable_pin = step_pin, dir_pin, enable_pin
+    self.invert_dir, self.enable_on = bool(flags & 1), 1 if flags & 2 else 0
+    self.enabled = False
+    self.forward = True
+    self.position = self.low = self.high = 0
+    self.steps = 0
+    self.times = []       # Recent step times, since the last stop or reversal
+    self.last_v = None    # (time, speed) at the middle of the last window
+    self.peak_v = self.peak_a = 0
+    self.peak_v_at = self.peak_a_at = 0
+    self.jitter_sum = self.jitter_n = 0
+    self.jitter_max = self.jitter_at = 0
+    self.rise = self.fall = self.dir_change = None
+    self.min_high = self.min_low = self.min_setup = None
+
+  def restart(self):
+    self.times = []
+    self.last_v = None
+
+def shortest(cur, val):
+  return val if cur is None or val < cur else cur
+
+def read_trace(f):
+  head = f.read(28)
+  magic, version, size, start, count = struct.unpack('<8sIIQI', head)
+  if magic != b'MGPIOTR\0' or version != 1 or size != 8:
+    sys.exit('%s is not a version 1 GPIO trace' % args.trace)
+  axes = []
+  for _ in range(count):
+    name, flags, step, dirp, enable, spm = struct.unpack('<cBhhhf', f.read(12))
+    axes.append(Axis(name.decode(), flags, step, dirp, enable, spm))
+  return start, axes
+
+def main():
+  overrides = dict(s.upper().split('=') for s in args.steps)
+  csv = open(args.csv, 'w') if args.csv else None
+  if csv: csv.write('time_s, axis, position_mm, velocity_mm_s, acceleration_mm_s2\n')
+
+  with open(args.trace, 'rb') as f:
+    start, axes = read_trace(f)
+    for a in axes:
+      if a.name in overrides: a.steps_per_mm = float(overrides[a.name])
+    by_pin = {}
+    for a in axes:
+      for pin in (a.step_pin, a.dir_pin, a.enable_pin):
+        if pin >= 0: by_pin.setdefault(pin, []).append(a)
+
+    t = events = 0
+    while True:
+      chunk = f.read(8 * 65536)
+      if not chunk: break
+      chunk = chunk[:len(chunk) - len(chunk) % 8]
+      for delta, pin, event, value in struct.iter_unpack('<IBBH', chunk):
+        t += delta
+        events += 1
+        if event == TIME or pin not in by_pin: continue
+        for a in by_pin[pin]:
+          if pin == a.enable_pin and event in (RISE, FALL, SET_VALUE):
+            a.enabled = (value != 0) == bool(a.enable_on)
+            if not a.enabled: a.restart()
+          if pin == a.dir_pin and event in (RISE, FALL, SET_VALUE):
+            forward = (value != 0) != a.invert_dir
+            if forward != a.forward:
+              a.forward = forward
+              a.dir_change = t
+              a.restart()
+          if pin == a.step_pin:
+            if event == FALL:
+              if a.rise is not None: a.min_high = shortest(a.min_high, t - a.rise)
+              a.fall = t
+            elif event == RISE:
+              if a.fall is not None: a.min_low = shortest(a.min_low, t - a.fall)
+              a.rise = t
+              if a.enabled: step(a, t, csv)
+
+  duration = t / 1e9
+  print('%s: %d events over %.3fs' % (args.trace, events, duration))
+  for a in axes:
+    report(a)
+
+def step(a, t, csv):
+  if a.dir_change is not None:
+    a.min_setup = shortest(a.min_setup, t - a.dir_change)
+    a.dir_change = None
+  a.steps += 1
+  a.position += 1 if a.forward else -1
+  a.low, a.high = min(a.low, a.position), max(a.high, a.position)
+
+  times = a.times
+  if times and t - times[-1] > gap_ns: a.restart()
+  times.append(t)
+
+  # Jitter of the interval before the last one, now it has neighbors both sides
+  if len(times) >= 4:
+    d0, d1, d2 = times[-3] - times[-4], times[-2] - times[-3], times[-1] - times[-2]
+    j = abs(d1 - (d0 + d2) / 2)
+    a.jitter_sum += j * j
+    a.jitter_n += 1
+    if j > a.jitter_max: a.jitter_max, a.jitter_at = j, times[-2]
+
+  w = args.window
+  v = a_mm = None
+  if len(times) > w:
+    v = w / ((times[-1] - times[-1 - w]) / 1e9) / a.steps_per_mm
+    if not a.forward: v = -v
+    mid = (times[-1] + times[-1 - w]) / 2
+    if abs(v) > abs(a.peak_v): a.peak_v, a.peak_v_at = v, t
+    if a.last_v is not None and mid > a.last_v[0]:
+      a_mm = (v - a.last_v[1]) / ((mid - a.last_v[0]) / 1e9)
+      if abs(a_mm) > abs(a.peak_a): a.peak_a, a.peak_a_at = a_mm, t
+    a.last_v = (mid, v)
+    del times[:-(w + 4)]
+
+  if csv:
+    csv.write('%.9f, %s, %.4f, %s, %s\n' % (t / 1e9, a.name, a.position / a.steps_per_mm,
+              '' if v is None else '%.3f' % v, '' if a_mm is None else '%.1f' % a_mm))
+
+def report(a):
+  if not a.steps:
+    print('%s: no steps' % a.name)
+    return
+  mm = lambda s: s / a.steps_per_mm
+  ns = lambda n: '-' if n is None else '%dns' % n
+  print('%s: %d steps, at %.3fmm, range %.3f to %.3fmm (%g steps/mm)' % (
+    a.name, a.steps, mm(a.position), mm(a.low), mm(a.high), a.steps_per_mm))
+  print('   peak %.1fmm/s at %.3fs, peak %.0fmm/s^2 at %.3fs (over %d steps)' % (
+    abs(a.peak_v), a.peak_v_at / 1e9, abs(a.peak_a), a.peak_a_at / 1e9, args.window))
+  if a.jitter_n:
+    print('   interval jitter %.2fus RMS, %.2fus max at %.6fs' % (
+      math.sqrt(a.jitter_sum / a.jitter_n) / 1e3, a.jitter_max / 1e3, a.jitter_at / 1e9))
+  print('   shortest STEP high %s, low %s, DIR to STEP %s' % (ns(a.min_high), ns(a.min_low), ns(a.min_setup)))
+
+main()
@@ -0,0 +1,90 @@
+#!/usr/bin/env python
+
+""" Measure motion pipeline throughput with the Linux simulator in virtual time.
+
+Each workload is piped through a linux_native_virtual build, so the G-code
+goes through the parser, GcodeSuite, the planner and the Stepper ISR exactly
+as on a printer. The simulator reports commands, blocks and steps per second
+of host time and the longest time the planner ran dry.
+
+Built-in workloads are generated on the fly: dense arcs, short segments like a
+sliced STL, and short zigzag infill. Any G-code files given are run as well.
+Give limits to fail (exit status 1) on a regression, e.g. from a CI script.
+"""
+
+from __future__ import print_function
+from __future__ import division
+
+import argparse, math, re, subprocess, sys
+
+parser = argparse.ArgumentParser(description=__doc__, formatter_class=argparse.RawDescriptionHelpFormatter)
+parser.add_argument('simulator', help='linux_native_virtual program')
+parser.add_argument('gcode', nargs='*', help='extra G-code files to run')
+parser.add_argument('-s', '--scale', type=int, default=1, help='repeat each built-in workload this many times (default=1)')
+parser.add_argument('--min-blocks-per-sec', type=float, default=0, help='fail if any workload plans fewer blocks per second')
+parser.add_argument('--max-starvation-ms', type=float, default=-1, help='fail if the planner runs dry for longer than this')
+args = parser.parse_args()
+
+PREAMBLE = ['G92 X100 Y100 Z0.2 E0', 'M302 P1', 'M83', 'G1 F6000']
+
+def arcs():
+  """ Concentric G2/G3 arcs with extrusion """
+  g = []
+  for r in range(2, 40):
+    g.append('G1 X%.3f Y100 E0.1' % (100 + r))
+    g.append('G2 X%.3f Y100 I%.3f J0 E%.3f' % (100 - r, -r, 0.05 * r))
+    g.append('G3 X%.3f Y100 I%.3f J0 E%.3f' % (100 + r, r, 0.05 * r))
+  return g
+
+def stl_slice():
+  """ A tessellated blob, outlines of 0.1-0.4mm segments, several layers """
+  g = []
+  for layer in range(6):
+    g.append('G1 Z%.2f' % (0.2 + 0.2 * layer))
+    for i in range(1500):
+      a = i * 2 * math.pi / 1500
+      r = 30 + 3 * math.sin(7 * a + layer) + 1.5 * math.sin(23 * a)
+      g.append('G1 X%.3f Y%.3f E0.01' % (100 + r * math.cos(a), 100 + r * math.sin(a)))
+  return g
+
+def infill():
+  """ Short zigzag lines, the worst case for junction handling """
+  g = []
+  for i in range(3000):
+    g.append('G1 X%.3f Y%.3f E0.01' % (90 + 2 * (i % 2), 70 + 0.2 * i / 5))
+  return g
+
+def run(name, lines):
+  lines = PREAMBLE + lines + ['M400']
+  proc = subprocess.Popen([args.simulator], stdin=subprocess.PIPE, stdout=subprocess.DEVNULL, stderr=subprocess.PIPE, universal_newlines=True)
+  _, err = proc.communicate('\n'.join(lines) + '\n')
+  if proc.returncode:
+    sys.exit('%s: simulator exited with %d\n%s' % (name, proc.returncode, err))
+  counts = re.search(r'Benchmark: (\d+) commands, (\d+) blocks, (\d+) steps in ([\d.]+)s', err)
+  rates = re.search(r'Benchmark: (\d+) commands/s, (\d+) blocks/s, (\d+) steps/s, peak starvation ([\d.]+)ms', err)
+  virtual = re.search(r'Simulated ([\d.]+)s', err)
+  if not counts or not rates or not virtual:
+    sys.exit('%s: no benchmark report. Is this a linux_native_virtual build?\n%s' % (name, err))
+  return dict(name=name, commands=int(counts.group(1)), blocks=int(counts.group(2)), steps=int(counts.group(3)),
+              host=float(counts.group(4)), virtual=float(virtual.group(1)),
+              cps=int(rates.group(1)), bps=int(rates.group(2)), sps=int(rates.group(3)), starved=float(rates.group(4)))
+
+workloads = [('arcs', arcs()), ('stl_slice', stl_slice()), ('infill', infill())]
+workloads = [(name, lines * args.scale) for name, lines in workloads]
+for path in args.gcode:
+  with open(path) as f:
+    workloads.append((path, [l.rstrip('\n') for l in f]))
+
+print('%-16s %9s %9s %10s %9s %9s %11s %9s %9s' % ('workload', 'commands', 'blocks', 'steps', 'print(s)', 'cmd/s', 'blocks/s', 'steps/s', 'dry(ms)'))
+failed = False
+for name, lines in workloads:
+  r = run(name, lines)
+  print('%-16s %9d %9d %10d %9.1f %9d %11d %9d %9.1f' % (r['name'], r['commands'], r['blocks'], r['steps'], r['virtual'], r['cps'], r['bps'], r['sps'], r['starved']))
+  if r['bps'] < args.min_blocks_per_sec:
+    print('  FAIL: %d blocks/s is below %d' % (r['bps'], args.min_blocks_per_sec))
+    failed = True
+  if args.max_starvation_ms >= 0 and r['starved'] > args.max_starvation_ms:
+    print('  FAIL: planner ran dry for %.1fms, limit is %.1fms' % (r['starved'], args.max_starvation_ms))
+    failed = True
+
+sys.exit(1 if failed else 0)
@@ -0,0 +1,139 @@
+#!/usr/bin/env python
+
+""" Find and check the ringing frequency used by INPUT_SHAPING.
+
+gcode: Write a ringing tower. Each layer is a square outline printed fast, so
+the X and Y axes ring after every corner. Print it with shaping off, measure
+the distance between the ripples after a corner, then
+
+    frequency = speed / ripple distance
+
+and set it with M593 F<freq>. Give --start and --end to step the shaper
+frequency up band by band instead, then pick the smoothest band.
+
+compare: Check a linux_native simulator run built with SHAPING_LOGGING against
+the ideal shaper. The shaped position should follow the planned steps filtered
+by the shaper impulses within about a step.
+"""
+
+from __future__ import print_function
+from __future__ import division
+
+import argparse, bisect, math, sys
+
+parser = argparse.ArgumentParser(description=__doc__, formatter_class=argparse.RawDescriptionHelpFormatter)
+sub = parser.add_subparsers(dest='command')
+
+g = sub.add_parser('gcode', help='write a ringing tower to stdout')
+g.add_argument('--size', type=float, default=60, help='side of the square (default=60mm)')
+g.add_argument('--center', type=float, nargs=2, default=[110, 110], metavar=('X', 'Y'), help='middle of the bed (default=110 110)')
+g.add_argument('--height', type=float, default=30, help='tower height (default=30mm)')
+g.add_argument('--layer', type=float, default=0.2, help='layer height (default=0.2mm)')
+g.add_argument('--width', type=float, default=0.45, help='line width (default=0.45mm)')
+g.add_argument('--filament', type=float, default=1.75, help='filament diameter (default=1.75mm)')
+g.add_argument('--speed', type=float, default=100, help='outline speed (default=100mm/s)')
+g.add_argument('--accel', type=float, default=3000, help='print acceleration (default=3000mm/s^2)')
+g.add_argument('--hotend', type=int, default=200, help='hotend temperature (default=200)')
+g.add_argument('--bed', type=int, default=60, help='bed temperature (default=60)')
+g.add_argument('--start', type=float, help='shaper frequency of the first band')
+g.add_argument('--end', type=float, help='shaper frequency of the last band')
+g.add_argument('--band', type=float, default=5, help='band height (default=5mm)')
+
+c = sub.add_parser('compare', help='check shaped steps against planned steps')
+c.add_argument('planned', help='unshaped_steps_log.csv')
+c.add_argument('shaped', help='shaped_steps_log.csv')
+c.add_argument('-f', '--freq', type=float, default=40, help='M593 F (default=40)')
+c.add_argument('-d', '--zeta', type=float, default=0.1, help='M593 D (default=0.1)')
+c.add_argument('-t', '--type', type=int, default=2, help='M593 T (default=2, MZV)')
+c.add_argument('--pins', type=int, nargs=4, default=[54, 55, 60, 61], metavar=('XSTEP', 'XDIR', 'YSTEP', 'YDIR'),
+               help='STEP and DIR pins (default=RAMPS 54 55 60 61)')
+args = parser.parse_args()
+
+def ringing_tower():
+  e_per_mm = args.width * args.layer / (math.pi * (args.filament / 2) ** 2)
+  x0, y0 = args.center[0] - args.size / 2, args.center[1] - args.size / 2
+  x1, y1 = x0 + args.size, y0 + args.size
+  tuning = args.start is not None and args.end is not None
+  bands = max(1, int(math.ceil(args.height / args.band)))
+  out = [
+    '; Ringing tower %gmm at %gmm/s, %gmm/s^2' % (args.size, args.speed, args.accel),
+    'M140 S%d' % args.bed, 'M104 S%d' % args.hotend, 'G28',
+    'M190 S%d' % args.bed, 'M109 S%d' % args.hotend,
+    'G90', 'M83', 'G92 E0', 'M204 P%g T%g' % (args.accel, args.accel),
+  ]
+  if not tuning: out.append('M593 F0 ; Shaping off to see the ringing')
+  band = -1
+  for n in range(int(round(args.height / args.layer))):
+    z = args.layer * (n + 1)
+    if tuning and int((z - args.layer / 2) / args.band) != band:
+      band = int((z - args.layer / 2) / args.band)
+      f = args.start + (args.end - args.start) * band / max(1, bands - 1)
+      out += ['M593 F%.1f' % f, 'M117 Band %d: %.1fHz' % (band + 1, f)]
+    out += ['G1 X%.3f Y%.3f Z%.3f F6000' % (x0, y0, z), 'G1 F%d' % (args.speed * 60)]
+    for x, y in ((x1, y0), (x1, y1), (x0, y1), (x0, y0)):
+      out.append('G1 X%.3f Y%.3f E%.5f' % (x, y, e_per_mm * args.size))
+  out += ['G1 Z%.3f F600' % (args.height + 10), 'M104 S0', 'M140 S0', 'M84']
+  print('\n'.join(out))
+
+def impulses():
+  """ The shaper impulses as (share, delay in s), as in feature/input_shaping.cpp """
+  zeta = args.zeta
+  df = math.sqrt(1 - zeta ** 2)
+  period = 1 / (args.freq * df)
+  K = math.exp(-zeta * math.pi / df)
+  if args.type == 0:   A, T = [1, K], [0, 0.5]
+  elif args.type == 1: A, T = [1, 2 * K, K ** 2], [0, 0.5, 1]
+  elif args.type == 2:
+    k = math.exp(-0.75 * zeta * math.pi / df)
+    a = 1 - math.sqrt(0.5)
+    A, T = [a, (math.sqrt(2) - 1) * k, a * k ** 2], [0, 0.375, 0.75]
+  else:
+    a = 0.25 * 1.05
+    A, T = [a, 0.5 * 0.95 * K, a * K ** 2], [0, 0.5, 1]
+  return [(a / sum(A), t * period) for a, t in zip(A, T)]
+
+def timeline(path, step_pin, dir_pin):
+  """ Step times in s and the position after each step """
+  times, pos, p, forward = [], [], 0, False
+  with open(path) as f:
+    for line in f:
+      t, pin, ev = [int(v) for v in line.split(',')]
+      if pin == dir_pin and ev in (1, 2): forward = ev == 2  # FALL / RISE
+      elif pin == step_pin and ev == 2:
+        p += 1 if forward else -1
+        times.append(t / 1e9)
+        pos.append(p)
+  return times, pos
+
+def position(tl, t):
+  i = bisect.bisect_right(tl[0], t)
+  return tl[1][i - 1] if i else 0
+
+def compare():
+  imp = impulses()
+  print('Shaper impulses: ' + ', '.join('%.3f at %.1fms' % (a, t * 1000) for a, t in imp))
+  failed = False
+  for name, step_pin, dir_pin in (('X', args.pins[0], args.pins[1]), ('Y', args.pins[2], args.pins[3])):
+    planned, shaped = timeline(args.planned, step_pin, dir_pin), timeline(args.shaped, step_pin, dir_pin)
+    if not planned[0]:
+      print('%s: no planned steps' % name)
+      continue
+    worst, worst_t, t = 0, 0, planned[0][0]
+    end = max(planned[0][-1], shaped[0][-1] if shaped[0] else 0) + imp[-1][1]
+    while t <= end:
+      ideal = sum(a * position(planned, t - d) for a, d in imp)
+      err = abs(position(shaped, t) - ideal)
+      if err > worst: worst, worst_t = err, t
+      t += 0.0001
+    end_planned, end_shaped = planned[1][-1], shaped[1][-1] if shaped[1] else 0
+    print('%s: %d planned steps, %d shaped steps, end %d / %d, off the ideal by up to %.2f steps at %.4fs'
+          % (name, len(planned[0]), len(shaped[0]), end_planned, end_shaped, worst, worst_t))
+    failed |= end_planned != end_shaped or worst > 1.5
+  sys.exit(1 if failed else 0)
+
+if args.command == 'gcode':
+  ringing_tower()
+elif args.command == 'compare':
+  compare()
+else:
+  parser.print_help()